@@ -0,0 +1,6 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <ltpl/arithmetic.hpp>
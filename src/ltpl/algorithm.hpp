@@ -0,0 +1,173 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_ALGORITHM_HPP
+#define LTPL_LTPL_ALGORITHM_HPP
+
+#include <ltpl/cat_view.hpp>
+#include <ltpl/tuple.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ltpl
+{
+namespace detail
+{
+template <class T>
+concept TupleLike = IsTuple<T> || is_cat_view_v<std::remove_cvref_t<T>>;
+
+// Fold expressions require an operator, these wrappers turn a binary function into one. Unlike a plain accumulator
+// variable they allow the type of the intermediate result to change with every element.
+template <class F, class T>
+struct LeftFold
+{
+    F& f;
+    T value;
+
+    template <class U>
+    friend constexpr auto operator<<(LeftFold&& fold, U&& element)
+    {
+        using Result = std::remove_cvref_t<decltype(fold.f(static_cast<T&&>(fold.value), static_cast<U&&>(element)))>;
+        return LeftFold<F, Result>{fold.f, fold.f(static_cast<T&&>(fold.value), static_cast<U&&>(element))};
+    }
+};
+
+template <class F, class T>
+struct RightFold
+{
+    F& f;
+    T value;
+
+    template <class U>
+    friend constexpr auto operator>>(U&& element, RightFold&& fold)
+    {
+        using Result = std::remove_cvref_t<decltype(fold.f(static_cast<U&&>(element), static_cast<T&&>(fold.value)))>;
+        return RightFold<F, Result>{fold.f, fold.f(static_cast<U&&>(element), static_cast<T&&>(fold.value))};
+    }
+};
+
+template <class Tuple>
+inline constexpr std::size_t tuple_like_size_v = std::tuple_size<std::remove_cvref_t<Tuple>>::value;
+}  // namespace detail
+
+// Invoke `f` with every element in order.
+template <detail::TupleLike Tuple, class F>
+constexpr void for_each(Tuple&& tuple, F&& f)
+{
+    ltpl::apply(
+        [&](auto&&... v)
+        {
+            (void(f(static_cast<decltype(v)&&>(v))), ...);
+        },
+        static_cast<Tuple&&>(tuple));
+}
+
+// Invoke `f` with the index of every element as a `std::integral_constant` and the element itself, in order.
+template <detail::TupleLike Tuple, class F>
+constexpr void for_each_indexed(Tuple&& tuple, F&& f)
+{
+    [&]<std::size_t... I>(std::index_sequence<I...>)
+    {
+        ltpl::apply(
+            [&](auto&&... v)
+            {
+                (void(f(std::integral_constant<std::size_t, I>{}, static_cast<decltype(v)&&>(v))), ...);
+            },
+            static_cast<Tuple&&>(tuple));
+    }(std::make_index_sequence<detail::tuple_like_size_v<Tuple>>{});
+}
+
+// Create a Tuple of the results of invoking `f` with every element. `f` is invoked in order and references that it
+// returns are stored as references.
+template <detail::TupleLike Tuple, class F>
+[[nodiscard]] constexpr auto transform(Tuple&& tuple, F&& f)
+{
+    return ltpl::apply(
+        [&](auto&&... v)
+        {
+            // Braced initialization guarantees left-to-right evaluation.
+            return ltpl::Tuple<decltype(f(static_cast<decltype(v)&&>(v)))...>{f(static_cast<decltype(v)&&>(v))...};
+        },
+        static_cast<Tuple&&>(tuple));
+}
+
+// Compute `f(...f(f(init, e0), e1)..., eN)`.
+template <detail::TupleLike Tuple, class T, class F>
+[[nodiscard]] constexpr auto fold_left(Tuple&& tuple, T&& init, F&& f)
+{
+    return ltpl::apply(
+        [&](auto&&... v)
+        {
+            return (detail::LeftFold<F, std::remove_cvref_t<T>>{f, static_cast<T&&>(init)} << ... <<
+                    static_cast<decltype(v)&&>(v))
+                .value;
+        },
+        static_cast<Tuple&&>(tuple));
+}
+
+// Compute `f(e0, f(e1, ...f(eN, init)...))`.
+template <detail::TupleLike Tuple, class T, class F>
+[[nodiscard]] constexpr auto fold_right(Tuple&& tuple, T&& init, F&& f)
+{
+    return ltpl::apply(
+        [&](auto&&... v)
+        {
+            return (static_cast<decltype(v)&&>(v) >> ... >>
+                    detail::RightFold<F, std::remove_cvref_t<T>>{f, static_cast<T&&>(init)})
+                .value;
+        },
+        static_cast<Tuple&&>(tuple));
+}
+
+// Test whether `f` returns true for any element. Stops at the first element for which it does.
+template <detail::TupleLike Tuple, class F>
+[[nodiscard]] constexpr bool any_of(Tuple&& tuple, F&& f)
+{
+    return ltpl::apply(
+        [&](auto&&... v)
+        {
+            return (false || ... || static_cast<bool>(f(static_cast<decltype(v)&&>(v))));
+        },
+        static_cast<Tuple&&>(tuple));
+}
+
+// Test whether `f` returns true for all elements. Stops at the first element for which it does not.
+template <detail::TupleLike Tuple, class F>
+[[nodiscard]] constexpr bool all_of(Tuple&& tuple, F&& f)
+{
+    return ltpl::apply(
+        [&](auto&&... v)
+        {
+            return (true && ... && static_cast<bool>(f(static_cast<decltype(v)&&>(v))));
+        },
+        static_cast<Tuple&&>(tuple));
+}
+
+// Test whether `f` returns false for all elements. Stops at the first element for which it does not.
+template <detail::TupleLike Tuple, class F>
+[[nodiscard]] constexpr bool none_of(Tuple&& tuple, F&& f)
+{
+    return !ltpl::any_of(static_cast<Tuple&&>(tuple), static_cast<F&&>(f));
+}
+
+// Obtain the index of the first element for which `f` returns true or the size of the Tuple if there is none. Stops at
+// the first element for which it does.
+template <detail::TupleLike Tuple, class F>
+[[nodiscard]] constexpr std::size_t find_if(Tuple&& tuple, F&& f)
+{
+    return ltpl::apply(
+        [&](auto&&... v)
+        {
+            std::size_t index{};
+            (void)(false || ... || (static_cast<bool>(f(static_cast<decltype(v)&&>(v))) || (++index, false)));
+            return index;
+        },
+        static_cast<Tuple&&>(tuple));
+}
+}  // namespace ltpl
+
+#endif  // LTPL_LTPL_ALGORITHM_HPP
@@ -0,0 +1,306 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_ARITHMETIC_HPP
+#define LTPL_LTPL_ARITHMETIC_HPP
+
+#include <ltpl/homogeneous_tuple.hpp>
+#include <ltpl/tuple.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ltpl
+{
+namespace detail
+{
+struct Plus
+{
+    template <class T, class U>
+    constexpr auto operator()(const T& lhs, const U& rhs) const -> decltype(lhs + rhs)
+    {
+        return lhs + rhs;
+    }
+};
+
+struct Minus
+{
+    template <class T, class U>
+    constexpr auto operator()(const T& lhs, const U& rhs) const -> decltype(lhs - rhs)
+    {
+        return lhs - rhs;
+    }
+};
+
+struct Multiplies
+{
+    template <class T, class U>
+    constexpr auto operator()(const T& lhs, const U& rhs) const -> decltype(lhs * rhs)
+    {
+        return lhs * rhs;
+    }
+};
+
+struct Divides
+{
+    template <class T, class U>
+    constexpr auto operator()(const T& lhs, const U& rhs) const -> decltype(lhs / rhs)
+    {
+        return lhs / rhs;
+    }
+};
+
+struct Min
+{
+    template <class T, class U>
+    constexpr auto operator()(const T& lhs, const U& rhs) const -> std::remove_cvref_t<decltype(true ? lhs : rhs)>
+    {
+        return rhs < lhs ? rhs : lhs;
+    }
+};
+
+struct Max
+{
+    template <class T, class U>
+    constexpr auto operator()(const T& lhs, const U& rhs) const -> std::remove_cvref_t<decltype(true ? lhs : rhs)>
+    {
+        return lhs < rhs ? rhs : lhs;
+    }
+};
+
+template <class Op, class T, class U>
+concept ElementwiseInvocable =
+    std::is_invocable_v<Op, const std::remove_reference_t<T>&, const std::remove_reference_t<U>&>;
+
+// The result of `Op` must be assignable back to the left-hand element for the compound assignments.
+template <class Op, class T, class U>
+concept ElementwiseAssignable =
+    ElementwiseInvocable<Op, T, U> &&
+    std::is_assignable_v<std::remove_reference_t<T>&, std::invoke_result_t<Op, const std::remove_reference_t<T>&,
+                                                                          const std::remove_reference_t<U>&>>;
+
+template <class Op, class... T, class... U>
+constexpr auto elementwise(const ltpl::Tuple<T...>& lhs, const ltpl::Tuple<U...>& rhs)
+{
+    return ltpl::apply(
+        [&](const auto&... v_lhs)
+        {
+            return ltpl::apply(
+                [&](const auto&... v_rhs)
+                {
+                    return ltpl::Tuple<std::remove_cvref_t<decltype(Op{}(v_lhs, v_rhs))>...>(Op{}(v_lhs, v_rhs)...);
+                },
+                rhs);
+        },
+        lhs);
+}
+
+template <class Op, class... T, class... U>
+constexpr void elementwise_assign(ltpl::Tuple<T...>& lhs, const ltpl::Tuple<U...>& rhs)
+{
+    ltpl::apply(
+        [&](auto&... v_lhs)
+        {
+            ltpl::apply(
+                [&](const auto&... v_rhs)
+                {
+                    (void(v_lhs = Op{}(v_lhs, v_rhs)), ...);
+                },
+                rhs);
+        },
+        lhs);
+}
+
+template <class Op, class T, std::size_t N>
+constexpr void elementwise_assign(ltpl::HomogeneousTuple<T, N>& result, const ltpl::HomogeneousTuple<T, N>& lhs,
+                                  const ltpl::HomogeneousTuple<T, N>& rhs)
+{
+    const auto lhs_span = ltpl::as_span(lhs);
+    const auto rhs_span = ltpl::as_span(rhs);
+    const auto result_span = ltpl::as_span(result);
+    for (std::size_t i{}; i != N; ++i)
+    {
+        result_span[i] = static_cast<T>(Op{}(lhs_span[i], rhs_span[i]));
+    }
+}
+
+template <class Op, class T, std::size_t N>
+constexpr ltpl::HomogeneousTuple<T, N> elementwise(const ltpl::HomogeneousTuple<T, N>& lhs,
+                                                   const ltpl::HomogeneousTuple<T, N>& rhs)
+{
+    ltpl::HomogeneousTuple<T, N> result{};
+    elementwise_assign<Op>(result, lhs, rhs);
+    return result;
+}
+}  // namespace detail
+
+// Element-wise arithmetic for Tuples and HomogeneousTuples. The operators must be brought into scope explicitly through
+// `using namespace ltpl::arithmetic;` since not every Tuple is meant to be a vector.
+namespace arithmetic
+{
+template <class... T, class... U>
+requires(sizeof...(T) == sizeof...(U) && (detail::ElementwiseInvocable<detail::Plus, T, U> && ... && true))
+[[nodiscard]] constexpr auto operator+(const ltpl::Tuple<T...>& lhs, const ltpl::Tuple<U...>& rhs)
+{
+    return detail::elementwise<detail::Plus>(lhs, rhs);
+}
+
+template <class... T, class... U>
+requires(sizeof...(T) == sizeof...(U) && (detail::ElementwiseAssignable<detail::Plus, T, U> && ... && true))
+constexpr ltpl::Tuple<T...>& operator+=(ltpl::Tuple<T...>& lhs, const ltpl::Tuple<U...>& rhs)
+{
+    detail::elementwise_assign<detail::Plus>(lhs, rhs);
+    return lhs;
+}
+
+template <class T, std::size_t N>
+requires std::is_arithmetic_v<T>
+[[nodiscard]] constexpr ltpl::HomogeneousTuple<T, N> operator+(const ltpl::HomogeneousTuple<T, N>& lhs,
+                                                               const ltpl::HomogeneousTuple<T, N>& rhs)
+{
+    return detail::elementwise<detail::Plus>(lhs, rhs);
+}
+
+template <class T, std::size_t N>
+requires std::is_arithmetic_v<T>
+constexpr ltpl::HomogeneousTuple<T, N>& operator+=(ltpl::HomogeneousTuple<T, N>& lhs,
+                                                   const ltpl::HomogeneousTuple<T, N>& rhs)
+{
+    detail::elementwise_assign<detail::Plus>(lhs, lhs, rhs);
+    return lhs;
+}
+
+template <class... T, class... U>
+requires(sizeof...(T) == sizeof...(U) && (detail::ElementwiseInvocable<detail::Minus, T, U> && ... && true))
+[[nodiscard]] constexpr auto operator-(const ltpl::Tuple<T...>& lhs, const ltpl::Tuple<U...>& rhs)
+{
+    return detail::elementwise<detail::Minus>(lhs, rhs);
+}
+
+template <class... T, class... U>
+requires(sizeof...(T) == sizeof...(U) && (detail::ElementwiseAssignable<detail::Minus, T, U> && ... && true))
+constexpr ltpl::Tuple<T...>& operator-=(ltpl::Tuple<T...>& lhs, const ltpl::Tuple<U...>& rhs)
+{
+    detail::elementwise_assign<detail::Minus>(lhs, rhs);
+    return lhs;
+}
+
+template <class T, std::size_t N>
+requires std::is_arithmetic_v<T>
+[[nodiscard]] constexpr ltpl::HomogeneousTuple<T, N> operator-(const ltpl::HomogeneousTuple<T, N>& lhs,
+                                                               const ltpl::HomogeneousTuple<T, N>& rhs)
+{
+    return detail::elementwise<detail::Minus>(lhs, rhs);
+}
+
+template <class T, std::size_t N>
+requires std::is_arithmetic_v<T>
+constexpr ltpl::HomogeneousTuple<T, N>& operator-=(ltpl::HomogeneousTuple<T, N>& lhs,
+                                                   const ltpl::HomogeneousTuple<T, N>& rhs)
+{
+    detail::elementwise_assign<detail::Minus>(lhs, lhs, rhs);
+    return lhs;
+}
+
+template <class... T, class... U>
+requires(sizeof...(T) == sizeof...(U) && (detail::ElementwiseInvocable<detail::Multiplies, T, U> && ... && true))
+[[nodiscard]] constexpr auto operator*(const ltpl::Tuple<T...>& lhs, const ltpl::Tuple<U...>& rhs)
+{
+    return detail::elementwise<detail::Multiplies>(lhs, rhs);
+}
+
+template <class... T, class... U>
+requires(sizeof...(T) == sizeof...(U) && (detail::ElementwiseAssignable<detail::Multiplies, T, U> && ... && true))
+constexpr ltpl::Tuple<T...>& operator*=(ltpl::Tuple<T...>& lhs, const ltpl::Tuple<U...>& rhs)
+{
+    detail::elementwise_assign<detail::Multiplies>(lhs, rhs);
+    return lhs;
+}
+
+template <class T, std::size_t N>
+requires std::is_arithmetic_v<T>
+[[nodiscard]] constexpr ltpl::HomogeneousTuple<T, N> operator*(const ltpl::HomogeneousTuple<T, N>& lhs,
+                                                               const ltpl::HomogeneousTuple<T, N>& rhs)
+{
+    return detail::elementwise<detail::Multiplies>(lhs, rhs);
+}
+
+template <class T, std::size_t N>
+requires std::is_arithmetic_v<T>
+constexpr ltpl::HomogeneousTuple<T, N>& operator*=(ltpl::HomogeneousTuple<T, N>& lhs,
+                                                   const ltpl::HomogeneousTuple<T, N>& rhs)
+{
+    detail::elementwise_assign<detail::Multiplies>(lhs, lhs, rhs);
+    return lhs;
+}
+
+template <class... T, class... U>
+requires(sizeof...(T) == sizeof...(U) && (detail::ElementwiseInvocable<detail::Divides, T, U> && ... && true))
+[[nodiscard]] constexpr auto operator/(const ltpl::Tuple<T...>& lhs, const ltpl::Tuple<U...>& rhs)
+{
+    return detail::elementwise<detail::Divides>(lhs, rhs);
+}
+
+template <class... T, class... U>
+requires(sizeof...(T) == sizeof...(U) && (detail::ElementwiseAssignable<detail::Divides, T, U> && ... && true))
+constexpr ltpl::Tuple<T...>& operator/=(ltpl::Tuple<T...>& lhs, const ltpl::Tuple<U...>& rhs)
+{
+    detail::elementwise_assign<detail::Divides>(lhs, rhs);
+    return lhs;
+}
+
+template <class T, std::size_t N>
+requires std::is_arithmetic_v<T>
+[[nodiscard]] constexpr ltpl::HomogeneousTuple<T, N> operator/(const ltpl::HomogeneousTuple<T, N>& lhs,
+                                                               const ltpl::HomogeneousTuple<T, N>& rhs)
+{
+    return detail::elementwise<detail::Divides>(lhs, rhs);
+}
+
+template <class T, std::size_t N>
+requires std::is_arithmetic_v<T>
+constexpr ltpl::HomogeneousTuple<T, N>& operator/=(ltpl::HomogeneousTuple<T, N>& lhs,
+                                                   const ltpl::HomogeneousTuple<T, N>& rhs)
+{
+    detail::elementwise_assign<detail::Divides>(lhs, lhs, rhs);
+    return lhs;
+}
+
+// Element-wise minimum.
+template <class... T, class... U>
+requires(sizeof...(T) == sizeof...(U) && (detail::ElementwiseInvocable<detail::Min, T, U> && ... && true))
+[[nodiscard]] constexpr auto min(const ltpl::Tuple<T...>& lhs, const ltpl::Tuple<U...>& rhs)
+{
+    return detail::elementwise<detail::Min>(lhs, rhs);
+}
+
+template <class T, std::size_t N>
+requires std::is_arithmetic_v<T>
+[[nodiscard]] constexpr ltpl::HomogeneousTuple<T, N> min(const ltpl::HomogeneousTuple<T, N>& lhs,
+                                                         const ltpl::HomogeneousTuple<T, N>& rhs)
+{
+    return detail::elementwise<detail::Min>(lhs, rhs);
+}
+
+// Element-wise maximum.
+template <class... T, class... U>
+requires(sizeof...(T) == sizeof...(U) && (detail::ElementwiseInvocable<detail::Max, T, U> && ... && true))
+[[nodiscard]] constexpr auto max(const ltpl::Tuple<T...>& lhs, const ltpl::Tuple<U...>& rhs)
+{
+    return detail::elementwise<detail::Max>(lhs, rhs);
+}
+
+template <class T, std::size_t N>
+requires std::is_arithmetic_v<T>
+[[nodiscard]] constexpr ltpl::HomogeneousTuple<T, N> max(const ltpl::HomogeneousTuple<T, N>& lhs,
+                                                         const ltpl::HomogeneousTuple<T, N>& rhs)
+{
+    return detail::elementwise<detail::Max>(lhs, rhs);
+}
+}  // namespace arithmetic
+}  // namespace ltpl
+
+#endif  // LTPL_LTPL_ARITHMETIC_HPP
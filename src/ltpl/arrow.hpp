@@ -0,0 +1,382 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_ARROW_HPP
+#define LTPL_LTPL_ARROW_HPP
+
+#include <ltpl/tuple.hpp>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// The structs of the Arrow C Data Interface, https://arrow.apache.org/docs/format/CDataInterface.html, defined exactly
+// as in the specification so that they are interchangeable with those of other Arrow headers.
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema
+{
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+    void (*release)(struct ArrowSchema*);
+    void* private_data;
+};
+
+struct ArrowArray
+{
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+    void (*release)(struct ArrowArray*);
+    void* private_data;
+};
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+namespace ltpl
+{
+namespace detail
+{
+template <class T>
+concept ArrowElement = std::is_same_v<T, bool> || std::is_same_v<T, std::string> ||
+                       (std::is_integral_v<T> && sizeof(T) <= sizeof(std::int64_t)) ||
+                       (std::is_floating_point_v<T> && std::numeric_limits<T>::is_iec559 &&
+                        (sizeof(T) == sizeof(std::uint32_t) || sizeof(T) == sizeof(std::uint64_t)));
+
+// The Arrow format string of an element type.
+template <class T>
+constexpr const char* arrow_format() noexcept
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        return "b";
+    }
+    else if constexpr (std::is_same_v<T, std::string>)
+    {
+        return "u";
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        return sizeof(T) == sizeof(std::uint32_t) ? "f" : "g";
+    }
+    else
+    {
+        constexpr std::array<const char*, 4> SIGNED{"c", "s", "i", "l"};
+        constexpr std::array<const char*, 4> UNSIGNED{"C", "S", "I", "L"};
+        constexpr auto INDEX = std::bit_width(sizeof(T)) - 1;
+        return std::is_signed_v<T> ? SIGNED[INDEX] : UNSIGNED[INDEX];
+    }
+}
+
+// Consumers must not dereference buffer pointers of empty buffers, but some reject null pointers nonetheless.
+inline constexpr std::int64_t ARROW_EMPTY_BUFFER{};
+
+// Shared by the exported struct and all of its children, so that children that have been moved out by the consumer
+// keep the data alive after the parent has been released.
+template <class... T>
+struct ArrowArrayHolder
+{
+    static constexpr std::size_t SIZE = sizeof...(T);
+
+    ltpl::Tuple<std::vector<T>...> columns;
+    std::array<std::vector<std::uint8_t>, SIZE> bitmaps;
+    std::array<std::vector<std::int32_t>, SIZE> offsets;
+    std::array<std::vector<char>, SIZE> string_data;
+    std::array<std::array<const void*, 3>, SIZE> buffers{};
+    std::array<const void*, 1> struct_buffers{};
+    std::array<ArrowArray, SIZE> children{};
+    std::array<ArrowArray*, SIZE> child_pointers{};
+};
+
+struct ArrowSchemaHolder
+{
+    std::vector<std::string> names;
+    std::vector<ArrowSchema> children;
+    std::vector<ArrowSchema*> child_pointers;
+};
+
+// Release callback of every exported struct: releases the children that have not been moved out and drops this
+// struct's share of the holder.
+template <class Holder, class Struct>
+void arrow_release(Struct* exported) noexcept
+{
+    for (std::int64_t i{}; i != exported->n_children; ++i)
+    {
+        auto* child = exported->children[i];
+        if (child->release != nullptr)
+        {
+            child->release(child);
+        }
+    }
+    delete static_cast<std::shared_ptr<Holder>*>(exported->private_data);
+    exported->release = nullptr;
+}
+
+inline const void* arrow_buffer(const void* data, std::size_t size) noexcept
+{
+    return size == 0 ? &ARROW_EMPTY_BUFFER : data;
+}
+
+template <class... T, std::size_t I>
+bool arrow_export_column(ArrowArrayHolder<T...>& holder, std::integral_constant<std::size_t, I>)
+{
+    using Element = std::tuple_element_t<I, ltpl::Tuple<T...>>;
+    auto& column = ltpl::get<I>(holder.columns);
+    auto& buffers = holder.buffers[I];
+    auto& child = holder.children[I];
+    child.length = static_cast<std::int64_t>(column.size());
+    child.n_buffers = 2;
+    if constexpr (std::is_same_v<Element, bool>)
+    {
+        auto& bitmap = holder.bitmaps[I];
+        bitmap.resize((column.size() + 7) / 8);
+        for (std::size_t i{}; i != column.size(); ++i)
+        {
+            bitmap[i / 8] |= static_cast<std::uint8_t>(column[i] ? 1u << (i % 8) : 0u);
+        }
+        buffers[1] = detail::arrow_buffer(bitmap.data(), bitmap.size());
+    }
+    else if constexpr (std::is_same_v<Element, std::string>)
+    {
+        auto& offsets = holder.offsets[I];
+        auto& data = holder.string_data[I];
+        offsets.reserve(column.size() + 1);
+        offsets.push_back(0);
+        for (const auto& value : column)
+        {
+            if (value.size() > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()) - data.size())
+            {
+                return false;
+            }
+            data.insert(data.end(), value.begin(), value.end());
+            offsets.push_back(static_cast<std::int32_t>(data.size()));
+        }
+        child.n_buffers = 3;
+        buffers[1] = offsets.data();
+        buffers[2] = detail::arrow_buffer(data.data(), data.size());
+    }
+    else
+    {
+        buffers[1] = detail::arrow_buffer(column.data(), column.size());
+    }
+    child.buffers = buffers.data();
+    return true;
+}
+
+// True if none of the `length` elements starting at `offset` is null.
+inline bool arrow_all_valid(const ArrowArray& array, std::int64_t offset, std::int64_t length) noexcept
+{
+    if (array.null_count == 0 || array.n_buffers == 0 || array.buffers[0] == nullptr)
+    {
+        return true;
+    }
+    const auto* validity = static_cast<const std::uint8_t*>(array.buffers[0]);
+    for (auto i = offset; i != offset + length; ++i)
+    {
+        if ((validity[i / 8] & (1u << (i % 8))) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <class T>
+bool arrow_import_column(const ArrowSchema& schema, const ArrowArray& array, std::int64_t offset,
+                         std::int64_t length, std::vector<T>& column)
+{
+    const std::string_view format = schema.format != nullptr ? schema.format : "";
+    const auto begin = offset + array.offset;
+    const bool is_large_string = std::is_same_v<T, std::string> && format == "U";
+    // The format of a dictionary-encoded column is that of its indices, which must not be mistaken for the values.
+    if (schema.dictionary != nullptr || array.dictionary != nullptr || schema.n_children != 0 ||
+        array.n_children != 0)
+    {
+        return false;
+    }
+    if ((format != detail::arrow_format<T>() && !is_large_string) || array.length < offset + length ||
+        array.n_buffers != (std::is_same_v<T, std::string> ? 3 : 2) || !detail::arrow_all_valid(array, begin, length))
+    {
+        return false;
+    }
+    column.reserve(static_cast<std::size_t>(length));
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        const auto* bitmap = static_cast<const std::uint8_t*>(array.buffers[1]);
+        for (auto i = begin; i != begin + length; ++i)
+        {
+            column.push_back((bitmap[i / 8] & (1u << (i % 8))) != 0);
+        }
+    }
+    else if constexpr (std::is_same_v<T, std::string>)
+    {
+        const auto* data = static_cast<const char*>(array.buffers[2]);
+        const auto import_strings = [&](const auto* offsets)
+        {
+            for (auto i = begin; i != begin + length; ++i)
+            {
+                column.emplace_back(data + offsets[i], static_cast<std::size_t>(offsets[i + 1] - offsets[i]));
+            }
+        };
+        if (is_large_string)
+        {
+            import_strings(static_cast<const std::int64_t*>(array.buffers[1]));
+        }
+        else
+        {
+            import_strings(static_cast<const std::int32_t*>(array.buffers[1]));
+        }
+    }
+    else
+    {
+        const auto* data = static_cast<const T*>(array.buffers[1]);
+        column.assign(data + begin, data + begin + length);
+    }
+    return true;
+}
+}  // namespace detail
+
+// Export a batch of columns as an Arrow struct array with one child per column, filling `schema` and `array` as
+// specified by the Arrow C Data Interface. The consumer owns both structs afterwards and must call their release
+// callbacks. Element types map to Arrow types at compile time: `bool` to boolean, integers to the integer type of the
+// same size and signedness, `float` and `double` to float32 and float64 and `std::string` to utf8. Integer and floating
+// point columns are moved into the export and their buffers are handed out without copying, boolean and string columns
+// are converted to the Arrow layout. Columns are named after `names`, if provided, or `f0`, `f1`, ... otherwise.
+// Returns false without filling the structs if the columns differ in length, the number of names does not match or a
+// string column exceeds 2 GiB.
+template <detail::ArrowElement... T>
+[[nodiscard]] bool export_to_arrow(ltpl::Tuple<std::vector<T>...>&& columns, ArrowSchema* schema, ArrowArray* array,
+                                   std::span<const std::string_view> names = {})
+{
+    constexpr auto SIZE = sizeof...(T);
+    if (!names.empty() && names.size() != SIZE)
+    {
+        return false;
+    }
+    const auto length = ltpl::apply(
+        [](const auto&... column)
+        {
+            std::array<std::size_t, SIZE> sizes{column.size()...};
+            return sizes;
+        },
+        columns);
+    const auto rows = SIZE == 0 ? std::size_t{} : length[0];
+    for (const auto size : length)
+    {
+        if (size != rows)
+        {
+            return false;
+        }
+    }
+
+    auto array_holder = std::make_shared<detail::ArrowArrayHolder<T...>>();
+    array_holder->columns = std::move(columns);
+    const bool exported = [&]<std::size_t... I>(std::index_sequence<I...>)
+    {
+        return (true && ... && detail::arrow_export_column(*array_holder, std::integral_constant<std::size_t, I>{}));
+    }(std::index_sequence_for<T...>{});
+    if (!exported)
+    {
+        columns = std::move(array_holder->columns);
+        return false;
+    }
+
+    auto schema_holder = std::make_shared<detail::ArrowSchemaHolder>();
+    schema_holder->children.resize(SIZE);
+    schema_holder->child_pointers.resize(SIZE);
+    constexpr std::array<const char*, SIZE> FORMATS{detail::arrow_format<T>()...};
+    for (std::size_t i{}; i != SIZE; ++i)
+    {
+        schema_holder->names.push_back(names.empty() ? "f" + std::to_string(i) : std::string(names[i]));
+    }
+    for (std::size_t i{}; i != SIZE; ++i)
+    {
+        auto& child_schema = schema_holder->children[i];
+        child_schema.format = FORMATS[i];
+        child_schema.name = schema_holder->names[i].c_str();
+        child_schema.release = &detail::arrow_release<detail::ArrowSchemaHolder, ArrowSchema>;
+        child_schema.private_data = new std::shared_ptr<detail::ArrowSchemaHolder>(schema_holder);
+        schema_holder->child_pointers[i] = &child_schema;
+
+        auto& child_array = array_holder->children[i];
+        child_array.release = &detail::arrow_release<detail::ArrowArrayHolder<T...>, ArrowArray>;
+        child_array.private_data = new std::shared_ptr<detail::ArrowArrayHolder<T...>>(array_holder);
+        array_holder->child_pointers[i] = &child_array;
+    }
+
+    *schema = ArrowSchema{};
+    schema->format = "+s";
+    schema->name = "";
+    schema->n_children = static_cast<std::int64_t>(SIZE);
+    schema->children = schema_holder->child_pointers.data();
+    schema->release = &detail::arrow_release<detail::ArrowSchemaHolder, ArrowSchema>;
+    schema->private_data = new std::shared_ptr<detail::ArrowSchemaHolder>(std::move(schema_holder));
+
+    *array = ArrowArray{};
+    array->length = static_cast<std::int64_t>(rows);
+    array->n_buffers = 1;
+    array->n_children = static_cast<std::int64_t>(SIZE);
+    array->buffers = array_holder->struct_buffers.data();
+    array->children = array_holder->child_pointers.data();
+    array->release = &detail::arrow_release<detail::ArrowArrayHolder<T...>, ArrowArray>;
+    array->private_data = new std::shared_ptr<detail::ArrowArrayHolder<T...>>(std::move(array_holder));
+    return true;
+}
+
+// Import an Arrow struct array whose children match `T...` as described for ltpl::export_to_arrow, e.g.
+// `ltpl::import_from_arrow<std::int64_t, std::string>(&schema, &array)`. Large utf8 children are accepted for
+// `std::string` columns. The data is copied into the returned columns and both structs are released. Returns an empty
+// optional if the types do not match, a child is dictionary-encoded or nested or a value is null.
+template <detail::ArrowElement... T>
+[[nodiscard]] std::optional<ltpl::Tuple<std::vector<T>...>> import_from_arrow(ArrowSchema* schema, ArrowArray* array)
+{
+    std::optional<ltpl::Tuple<std::vector<T>...>> result{std::in_place};
+    if (std::string_view(schema->format != nullptr ? schema->format : "") != "+s" ||
+        schema->n_children != static_cast<std::int64_t>(sizeof...(T)) || array->n_children != schema->n_children ||
+        array->n_buffers != 1 || !detail::arrow_all_valid(*array, array->offset, array->length) ||
+        !ltpl::apply(
+            [&](auto&... column)
+            {
+                std::size_t i{};
+                return (true && ... &&
+                        (++i, detail::arrow_import_column(*schema->children[i - 1], *array->children[i - 1],
+                                                          array->offset, array->length, column)));
+            },
+            *result))
+    {
+        result.reset();
+    }
+    array->release(array);
+    schema->release(schema);
+    return result;
+}
+}  // namespace ltpl
+
+#endif  // LTPL_LTPL_ARROW_HPP
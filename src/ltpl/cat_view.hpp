@@ -0,0 +1,204 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_CAT_VIEW_HPP
+#define LTPL_LTPL_CAT_VIEW_HPP
+
+#include <ltpl/tuple.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ltpl
+{
+template <class... Tuples>
+class CatView;
+
+namespace detail
+{
+template <class... Tuples>
+inline constexpr auto cat_view_indices = []
+{
+    constexpr std::array<std::size_t, sizeof...(Tuples)> sizes{tuple_size_v<std::remove_cvref_t<Tuples>>...};
+    std::array<TupleCatIndex, (std::size_t{} + ... + tuple_size_v<std::remove_cvref_t<Tuples>>)> array{};
+    std::size_t i{};
+    for (std::size_t outer{}; outer != sizes.size(); ++outer)
+    {
+        for (std::size_t inner{}; inner != sizes[outer]; ++inner)
+        {
+            array[i] = {outer, inner};
+            ++i;
+        }
+    }
+    return array;
+}();
+
+// The element type of a CatView is the type that ltpl::get returns for an lvalue source Tuple, e.g. `int&` for a
+// `Tuple<int>` and `const int&` for a const `Tuple<int>`. Rvalue source Tuples are owned by the CatView and contribute
+// their own element types.
+template <std::size_t I, class... Tuples>
+struct CatViewElement
+{
+    static constexpr auto INDEX = cat_view_indices<Tuples...>[I];
+
+    using Source = decltype(detail::get_nth<INDEX.outer>(std::declval<Tuples>()...));
+
+    using type = std::conditional_t<std::is_lvalue_reference_v<Source>,
+                                    decltype(ltpl::get<INDEX.inner>(std::declval<Source>())),
+                                    std::tuple_element_t<INDEX.inner, std::remove_cvref_t<Source>>>;
+};
+
+template <std::size_t I, class... Tuples>
+using CatViewElementT = typename CatViewElement<I, Tuples...>::type;
+
+template <class T>
+inline constexpr bool is_cat_view_v = false;
+
+template <class... Tuples>
+inline constexpr bool is_cat_view_v<ltpl::CatView<Tuples...>> = true;
+
+struct CatViewAccess
+{
+    template <std::size_t I, class View>
+    static constexpr decltype(auto) get(View& view) noexcept
+    {
+        return std::remove_const_t<View>::template element<I>(view);
+    }
+};
+}  // namespace detail
+
+// A lazy concatenation of Tuples. Element access is forwarded to the source Tuples through a compile-time index
+// mapping. Lvalue sources are referenced and must outlive the view, rvalue sources are moved into the view so that it
+// can be returned or stored beyond the full-expression that created it.
+template <class... Tuples>
+class CatView
+{
+  public:
+    constexpr explicit CatView(Tuples&&... tuples) noexcept(
+        (true && ... && std::is_nothrow_constructible_v<Tuples, Tuples&&>))
+        : sources(static_cast<Tuples&&>(tuples)...)
+    {
+    }
+
+    CatView(const CatView&) = default;
+
+    CatView(CatView&&) = default;
+
+    ~CatView() = default;
+
+    CatView& operator=(const CatView&) = delete;
+
+    CatView& operator=(CatView&&) = delete;
+
+    template <class... U>
+    [[nodiscard]] friend constexpr bool operator==(const CatView& lhs, const ltpl::Tuple<U...>& rhs)  //
+    requires(sizeof...(U) == std::tuple_size<CatView>::value)
+    {
+        return lhs.equals(rhs);
+    }
+
+    template <class... U>
+    [[nodiscard]] friend constexpr bool operator==(const CatView& lhs, const CatView<U...>& rhs)  //
+    requires(std::tuple_size<CatView<U...>>::value == std::tuple_size<CatView>::value)
+    {
+        return lhs.equals(rhs);
+    }
+
+  private:
+    friend detail::CatViewAccess;
+
+    template <class...>
+    friend class ltpl::CatView;
+
+    template <std::size_t I, class Self>
+    static constexpr decltype(auto) element(Self& self) noexcept
+    {
+        constexpr auto index = detail::cat_view_indices<Tuples...>[I];
+        return ltpl::get<index.inner>(ltpl::get<index.outer>(self.sources));
+    }
+
+    template <class Other>
+    constexpr bool equals(const Other& other) const
+    {
+        return [&]<std::size_t... I>(std::index_sequence<I...>)
+        {
+            if constexpr (detail::is_cat_view_v<Other>)
+            {
+                return (true && ... && (CatView::element<I>(*this) == Other::template element<I>(other)));
+            }
+            else
+            {
+                return (true && ... && (CatView::element<I>(*this) == ltpl::get<I>(other)));
+            }
+        }(std::make_index_sequence<std::tuple_size<CatView>::value>{});
+    }
+
+    ltpl::Tuple<Tuples...> sources;
+};
+
+template <std::size_t I, class... Tuples>
+[[nodiscard]] constexpr std::tuple_element_t<I, CatView<Tuples...>>& get(CatView<Tuples...>& view) noexcept
+{
+    auto&& v = detail::CatViewAccess::get<I>(view);
+    return static_cast<std::tuple_element_t<I, CatView<Tuples...>>&>(v);
+}
+
+template <std::size_t I, class... Tuples>
+[[nodiscard]] constexpr const std::tuple_element_t<I, CatView<Tuples...>>& get(const CatView<Tuples...>& view) noexcept
+{
+    auto&& v = detail::CatViewAccess::get<I>(view);
+    return static_cast<const std::tuple_element_t<I, CatView<Tuples...>>&>(v);
+}
+
+template <std::size_t I, class... Tuples>
+[[nodiscard]] constexpr std::tuple_element_t<I, CatView<Tuples...>>&& get(CatView<Tuples...>&& view) noexcept
+{
+    auto&& v = detail::CatViewAccess::get<I>(view);
+    return static_cast<std::tuple_element_t<I, CatView<Tuples...>>&&>(v);
+}
+
+template <std::size_t I, class... Tuples>
+[[nodiscard]] constexpr const std::tuple_element_t<I, CatView<Tuples...>>&& get(
+    const CatView<Tuples...>&& view) noexcept
+{
+    auto&& v = detail::CatViewAccess::get<I>(view);
+    return static_cast<const std::tuple_element_t<I, CatView<Tuples...>>&&>(v);
+}
+
+// Create a view that behaves like `ltpl::tuple_cat(tuples...)` without copying the elements of lvalue Tuples.
+template <detail::IsTuple... Tuples>
+[[nodiscard]] constexpr CatView<Tuples...> cat_view(Tuples&&... tuples) noexcept(
+    (true && ... && std::is_nothrow_constructible_v<Tuples, Tuples&&>))
+{
+    return CatView<Tuples...>(static_cast<Tuples&&>(tuples)...);
+}
+
+// Invoke `f` with all elements of the CatView.
+template <class F, class View>
+requires detail::is_cat_view_v<std::remove_cvref_t<View>>
+constexpr decltype(auto) apply(F&& f, View&& view)
+{
+    return [&]<std::size_t... I>(std::index_sequence<I...>) -> decltype(auto)
+    {
+        return static_cast<F&&>(f)(ltpl::get<I>(static_cast<View&&>(view))...);
+    }(std::make_index_sequence<std::tuple_size<std::remove_cvref_t<View>>::value>{});
+}
+}  // namespace ltpl
+
+template <class... Tuples>
+struct std::tuple_size<ltpl::CatView<Tuples...>>
+    : std::integral_constant<std::size_t, ltpl::detail::cat_view_indices<Tuples...>.size()>
+{
+};
+
+template <std::size_t I, class... Tuples>
+struct std::tuple_element<I, ltpl::CatView<Tuples...>>
+{
+    using type = ltpl::detail::CatViewElementT<I, Tuples...>;
+};
+
+#endif  // LTPL_LTPL_CAT_VIEW_HPP
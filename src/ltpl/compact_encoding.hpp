@@ -0,0 +1,407 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_COMPACT_ENCODING_HPP
+#define LTPL_LTPL_COMPACT_ENCODING_HPP
+
+#include <ltpl/tuple.hpp>
+
+#include <array>
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace ltpl
+{
+namespace detail
+{
+template <class T>
+inline constexpr bool is_compact_integer_v = std::is_integral_v<T> && sizeof(T) <= sizeof(std::uint64_t);
+
+template <class T>
+inline constexpr bool is_compact_float_v =
+    std::is_floating_point_v<T> && std::numeric_limits<T>::is_iec559 &&
+    (sizeof(T) == sizeof(std::uint32_t) || sizeof(T) == sizeof(std::uint64_t));
+
+template <class T>
+inline constexpr bool is_compact_encodable_v = is_compact_integer_v<T> || std::is_enum_v<T> || is_compact_float_v<T> ||
+                                               std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>;
+
+template <class... T>
+inline constexpr bool is_compact_encodable_v<ltpl::Tuple<T...>> =
+    (is_compact_encodable_v<std::remove_cvref_t<T>> && ... && true);
+
+template <class T>
+inline constexpr bool is_compact_decodable_v = is_compact_encodable_v<T> && !std::is_same_v<T, std::string_view>;
+
+template <class... T>
+inline constexpr bool is_compact_decodable_v<ltpl::Tuple<T...>> =
+    ((std::is_same_v<T, std::remove_cvref_t<T>> && is_compact_decodable_v<T>) && ... && true);
+
+template <class T>
+using CompactIntegerT =
+    typename std::conditional_t<std::is_enum_v<T>, std::underlying_type<T>, std::type_identity<T>>::type;
+
+template <class T>
+inline constexpr std::size_t varint_max_size_v = (std::numeric_limits<std::make_unsigned_t<T>>::digits + 6) / 7;
+
+inline constexpr std::size_t COMPACT_UNBOUNDED = std::numeric_limits<std::size_t>::max();
+
+// The largest encoded size of a value of type T, or COMPACT_UNBOUNDED for strings and Tuples that contain them.
+template <class T>
+constexpr std::size_t compact_max_size() noexcept
+{
+    if constexpr (IsTuple<T>)
+    {
+        return []<class... U>(std::type_identity<ltpl::Tuple<U...>>)
+        {
+            std::size_t size{};
+            ((size = size == COMPACT_UNBOUNDED || compact_max_size<std::remove_cvref_t<U>>() == COMPACT_UNBOUNDED
+                         ? COMPACT_UNBOUNDED
+                         : size + compact_max_size<std::remove_cvref_t<U>>()),
+             ...);
+            return size;
+        }(std::type_identity<T>{});
+    }
+    else if constexpr (std::is_same_v<CompactIntegerT<T>, bool>)
+    {
+        // Also enums with `bool` as underlying type, which `std::make_unsigned` does not accept.
+        return 1;
+    }
+    else if constexpr (is_compact_float_v<T>)
+    {
+        return sizeof(T);
+    }
+    else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+    {
+        return varint_max_size_v<CompactIntegerT<T>>;
+    }
+    else
+    {
+        return COMPACT_UNBOUNDED;
+    }
+}
+
+// An upper bound for the encoded size of this particular value.
+template <class T>
+std::size_t compact_size_bound(const T& value) noexcept
+{
+    if constexpr (compact_max_size<T>() != COMPACT_UNBOUNDED)
+    {
+        return compact_max_size<T>();
+    }
+    else if constexpr (IsTuple<T>)
+    {
+        return ltpl::apply(
+            [](const auto&... v)
+            {
+                return (detail::compact_size_bound(v) + ... + std::size_t{});
+            },
+            value);
+    }
+    else
+    {
+        return varint_max_size_v<std::size_t> + value.size();
+    }
+}
+
+template <class U>
+std::byte* compact_encode_varint(U value, std::byte* out) noexcept
+{
+    while (value >= 0x80)
+    {
+        *out++ = static_cast<std::byte>(value | 0x80);
+        value = static_cast<U>(value >> 7);
+    }
+    *out++ = static_cast<std::byte>(value);
+    return out;
+}
+
+// Zigzag maps signed integers of small magnitude to small unsigned integers: 0, -1, 1, -2, ... become 0, 1, 2, 3, ...
+template <class T>
+constexpr std::make_unsigned_t<T> zigzag_encode(T value) noexcept
+{
+    using U = std::make_unsigned_t<T>;
+    return static_cast<U>(static_cast<U>(static_cast<U>(value) << 1) ^
+                          static_cast<U>(value >> (std::numeric_limits<U>::digits - 1)));
+}
+
+template <class T>
+constexpr T zigzag_decode(std::make_unsigned_t<T> value) noexcept
+{
+    using U = std::make_unsigned_t<T>;
+    return static_cast<T>(static_cast<U>(value >> 1) ^ static_cast<U>(U{} - static_cast<U>(value & 1)));
+}
+
+template <class T>
+std::byte* compact_encode_element(const T& value, std::byte* out) noexcept
+{
+    if constexpr (IsTuple<T>)
+    {
+        ltpl::apply(
+            [&](const auto&... v)
+            {
+                ((out = detail::compact_encode_element(v, out)), ...);
+            },
+            value);
+        return out;
+    }
+    else if constexpr (std::is_same_v<T, bool>)
+    {
+        *out = static_cast<std::byte>(value ? 1 : 0);
+        return out + 1;
+    }
+    else if constexpr (std::is_enum_v<T>)
+    {
+        return detail::compact_encode_element(static_cast<std::underlying_type_t<T>>(value), out);
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        if constexpr (std::is_signed_v<T>)
+        {
+            return detail::compact_encode_varint(detail::zigzag_encode(value), out);
+        }
+        else
+        {
+            return detail::compact_encode_varint(value, out);
+        }
+    }
+    else if constexpr (is_compact_float_v<T>)
+    {
+        // Little-endian independent of the host.
+        using U = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+        const auto bits = std::bit_cast<U>(value);
+        for (std::size_t i{}; i != sizeof(U); ++i)
+        {
+            *out++ = static_cast<std::byte>(bits >> (i * CHAR_BIT));
+        }
+        return out;
+    }
+    else
+    {
+        out = detail::compact_encode_varint(value.size(), out);
+        if (!value.empty())
+        {
+            std::memcpy(out, value.data(), value.size());
+        }
+        return out + value.size();
+    }
+}
+
+// Fails on truncated input and on values that do not fit into U.
+template <class U>
+bool compact_decode_varint(const std::byte*& in, const std::byte* end, U& value) noexcept
+{
+    constexpr auto DIGITS = std::numeric_limits<U>::digits;
+    std::uint64_t result{};
+    for (int shift{}; shift < DIGITS; shift += 7)
+    {
+        if (in == end)
+        {
+            return false;
+        }
+        const auto byte = std::to_integer<std::uint64_t>(*in++);
+        const auto payload = byte & 0x7F;
+        if (DIGITS - shift < 7 && (payload >> (DIGITS - shift)) != 0)
+        {
+            return false;
+        }
+        result |= payload << shift;
+        if (byte < 0x80)
+        {
+            value = static_cast<U>(result);
+            return true;
+        }
+    }
+    return false;
+}
+
+template <class T>
+bool compact_decode_element(const std::byte*& in, const std::byte* end, T& value)
+{
+    if constexpr (IsTuple<T>)
+    {
+        return ltpl::apply(
+            [&](auto&... v)
+            {
+                return (true && ... && detail::compact_decode_element(in, end, v));
+            },
+            value);
+    }
+    else if constexpr (std::is_same_v<T, bool>)
+    {
+        if (in == end || std::to_integer<unsigned>(*in) > 1)
+        {
+            return false;
+        }
+        value = std::to_integer<unsigned>(*in++) == 1;
+        return true;
+    }
+    else if constexpr (std::is_enum_v<T>)
+    {
+        std::underlying_type_t<T> underlying{};
+        if (!detail::compact_decode_element(in, end, underlying))
+        {
+            return false;
+        }
+        value = static_cast<T>(underlying);
+        return true;
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        std::make_unsigned_t<T> bits{};
+        if (!detail::compact_decode_varint(in, end, bits))
+        {
+            return false;
+        }
+        if constexpr (std::is_signed_v<T>)
+        {
+            value = detail::zigzag_decode<T>(bits);
+        }
+        else
+        {
+            value = bits;
+        }
+        return true;
+    }
+    else if constexpr (is_compact_float_v<T>)
+    {
+        using U = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+        if (static_cast<std::size_t>(end - in) < sizeof(U))
+        {
+            return false;
+        }
+        U bits{};
+        for (std::size_t i{}; i != sizeof(U); ++i)
+        {
+            bits |= std::to_integer<U>(*in++) << (i * CHAR_BIT);
+        }
+        value = std::bit_cast<T>(bits);
+        return true;
+    }
+    else
+    {
+        std::size_t size{};
+        if (!detail::compact_decode_varint(in, end, size) || size > static_cast<std::size_t>(end - in))
+        {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char*>(in), size);
+        in += size;
+        return true;
+    }
+}
+
+template <class T>
+inline constexpr bool is_compact_small_integer_v = std::is_integral_v<T> || std::is_enum_v<T>;
+
+template <class T>
+void compact_decode_small_integer(std::byte byte, T& value) noexcept
+{
+    using Integer = CompactIntegerT<T>;
+    if constexpr (std::is_same_v<Integer, bool>)
+    {
+        value = static_cast<T>(byte != std::byte{});
+    }
+    else if constexpr (std::is_signed_v<Integer>)
+    {
+        value = static_cast<T>(detail::zigzag_decode<Integer>(std::to_integer<std::make_unsigned_t<Integer>>(byte)));
+    }
+    else
+    {
+        value = static_cast<T>(std::to_integer<Integer>(byte));
+    }
+}
+
+// For Tuples of at most eight integers, the common case of every integer being encoded in a single byte is detected by
+// combining the leading bytes into one mask, after which each element is decoded without further branches.
+template <class... T>
+bool compact_decode_small_integers(const std::byte*& in, const std::byte* end, ltpl::Tuple<T...>& tuple) noexcept
+{
+    constexpr auto SIZE = sizeof...(T);
+    if constexpr (SIZE == 0 || SIZE > 8 || !(is_compact_small_integer_v<T> && ...))
+    {
+        return false;
+    }
+    else
+    {
+        if (static_cast<std::size_t>(end - in) < SIZE)
+        {
+            return false;
+        }
+        std::array<unsigned char, SIZE> bytes;
+        std::memcpy(bytes.data(), in, SIZE);
+        unsigned combined{};
+        unsigned bool_out_of_range{};
+        [&]<std::size_t... I>(std::index_sequence<I...>)
+        {
+            ((combined |= bytes[I]), ...);
+            ((bool_out_of_range |=
+              std::is_same_v<CompactIntegerT<T>, bool> ? static_cast<unsigned>(bytes[I] > 1) : 0u),
+             ...);
+        }(std::index_sequence_for<T...>{});
+        if ((combined & 0x80) != 0 || bool_out_of_range != 0)
+        {
+            return false;
+        }
+        ltpl::apply(
+            [&](auto&... v)
+            {
+                std::size_t i{};
+                (detail::compact_decode_small_integer(static_cast<std::byte>(bytes[i++]), v), ...);
+            },
+            tuple);
+        in += SIZE;
+        return true;
+    }
+}
+}  // namespace detail
+
+// The largest number of bytes that ltpl::compact_encode writes for a Tuple that does not contain strings.
+template <class TupleT>
+requires detail::IsTuple<TupleT> && (detail::compact_max_size<TupleT>() != detail::COMPACT_UNBOUNDED)
+inline constexpr std::size_t compact_max_size_v = detail::compact_max_size<TupleT>();
+
+// Append a compact, host-independent encoding of the Tuple to `buffer`: integers as LEB128 varints, signed ones
+// zigzag-encoded first, `bool` as one byte, `float` and `double` as little-endian IEEE 754 and strings as a varint
+// length followed by their characters. Nested Tuples are encoded element by element.
+template <class... T>
+requires detail::is_compact_encodable_v<ltpl::Tuple<T...>>
+void compact_encode(const ltpl::Tuple<T...>& tuple, std::vector<std::byte>& buffer)
+{
+    const auto offset = buffer.size();
+    buffer.resize(offset + detail::compact_size_bound(tuple));
+    const auto* end = detail::compact_encode_element(tuple, buffer.data() + offset);
+    buffer.resize(static_cast<std::size_t>(end - buffer.data()));
+}
+
+// Decode a Tuple from the front of `input` that has been written by ltpl::compact_encode and advance `input` past it.
+// Returns an empty optional and leaves `input` unchanged if it is truncated or a value does not fit its type.
+template <class TupleT>
+requires detail::IsTuple<TupleT> && detail::is_compact_decodable_v<TupleT>
+[[nodiscard]] std::optional<TupleT> compact_decode(std::span<const std::byte>& input)
+{
+    std::optional<TupleT> result{std::in_place};
+    const auto* in = input.data();
+    const auto* end = in + input.size();
+    if (!detail::compact_decode_small_integers(in, end, *result) && !detail::compact_decode_element(in, end, *result))
+    {
+        return std::nullopt;
+    }
+    input = input.subspan(static_cast<std::size_t>(in - input.data()));
+    return result;
+}
+}  // namespace ltpl
+
+#endif  // LTPL_LTPL_COMPACT_ENCODING_HPP
@@ -0,0 +1,643 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_COMPRESSED_TUPLE_BATCH_HPP
+#define LTPL_LTPL_COMPRESSED_TUPLE_BATCH_HPP
+
+#include <ltpl/compact_encoding.hpp>
+#include <ltpl/tuple.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ltpl
+{
+// The encoding that ltpl::CompressedColumn chose for the values of a column, or for the dictionary codes of a string
+// column.
+enum class ColumnEncoding
+{
+    // Offsets from the minimum packed with as many bits as the largest offset needs.
+    BIT_PACKED,
+
+    // Pairs of value and run length, for columns with long runs of repeated values.
+    RUN_LENGTH,
+
+    // Bit-packed differences between consecutive deltas, for monotonic sequences like timestamps.
+    DELTA_OF_DELTA
+};
+
+namespace detail
+{
+template <class T>
+concept CompressedElement = std::is_same_v<T, std::string> ||
+                            (std::is_integral_v<T> && sizeof(T) <= sizeof(std::uint64_t)) ||
+                            (std::is_floating_point_v<T> && std::numeric_limits<T>::is_iec559 &&
+                             (sizeof(T) == sizeof(std::uint32_t) || sizeof(T) == sizeof(std::uint64_t)));
+
+inline constexpr std::uint64_t COMPRESSED_SIGN_BIT = std::uint64_t{1} << 63;
+
+// Values are compressed as 64-bit keys. Signed integers have their sign bit flipped so that the order of the keys
+// matches the order of the values, floating point numbers are compressed by their bit pattern.
+template <class T>
+constexpr std::uint64_t to_compressed_key(T value) noexcept
+{
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        return std::bit_cast<std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>>(
+            value);
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        return static_cast<std::uint64_t>(static_cast<std::int64_t>(value)) ^ COMPRESSED_SIGN_BIT;
+    }
+    else
+    {
+        return static_cast<std::uint64_t>(value);
+    }
+}
+
+template <class T>
+constexpr T from_compressed_key(std::uint64_t key) noexcept
+{
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        using U = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+        return std::bit_cast<T>(static_cast<U>(key));
+    }
+    else if constexpr (std::is_same_v<T, bool>)
+    {
+        return key != 0;
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        return static_cast<T>(static_cast<std::int64_t>(key ^ COMPRESSED_SIGN_BIT));
+    }
+    else
+    {
+        return static_cast<T>(key);
+    }
+}
+
+// Zigzag of the wrapped difference, so that small negative differences take few bits.
+constexpr std::uint64_t compressed_delta_encode(std::uint64_t delta) noexcept
+{
+    return detail::zigzag_encode(static_cast<std::int64_t>(delta));
+}
+
+constexpr std::uint64_t compressed_delta_decode(std::uint64_t value) noexcept
+{
+    return static_cast<std::uint64_t>(detail::zigzag_decode<std::int64_t>(value));
+}
+
+constexpr std::size_t packed_size_bytes(std::size_t count, unsigned width) noexcept
+{
+    return (count * width + 63) / 64 * sizeof(std::uint64_t);
+}
+
+// Integers of `width` bits stored back to back in 64-bit words.
+class PackedIntegers
+{
+  public:
+    PackedIntegers() = default;
+
+    template <class F>
+    PackedIntegers(std::size_t size, unsigned width, F&& value_at)
+        : words((size * width + 63) / 64), width_(width)
+    {
+        if (width == 0)
+        {
+            return;
+        }
+        for (std::size_t i{}; i != size; ++i)
+        {
+            const std::uint64_t value = value_at(i);
+            const auto bit = i * width;
+            const auto word = bit / 64;
+            const auto shift = bit % 64;
+            words[word] |= value << shift;
+            if (shift + width > 64)
+            {
+                words[word + 1] |= value >> (64 - shift);
+            }
+        }
+    }
+
+    [[nodiscard]] std::uint64_t operator[](std::size_t i) const noexcept
+    {
+        if (width_ == 0)
+        {
+            return 0;
+        }
+        const auto bit = i * width_;
+        const auto word = bit / 64;
+        const auto shift = bit % 64;
+        auto value = words[word] >> shift;
+        if (shift + width_ > 64)
+        {
+            value |= words[word + 1] << (64 - shift);
+        }
+        return width_ == 64 ? value : value & ((std::uint64_t{1} << width_) - 1);
+    }
+
+    [[nodiscard]] std::size_t size_bytes() const noexcept { return words.size() * sizeof(std::uint64_t); }
+
+  private:
+    std::vector<std::uint64_t> words;
+    unsigned width_{};
+};
+
+// A sequence of 64-bit keys in the smallest of the encodings of ltpl::ColumnEncoding. Delta-of-delta stores the key
+// and delta at the start of every block, so that a point lookup decodes at most one block.
+class CompressedIntegers
+{
+  public:
+    static constexpr std::size_t BLOCK_SIZE = 128;
+
+    // Decodes the keys in order.
+    class Cursor
+    {
+      public:
+        Cursor() = default;
+
+        explicit Cursor(const CompressedIntegers& integers) noexcept : integers(&integers) {}
+
+        std::uint64_t next() noexcept
+        {
+            const auto& c = *integers;
+            const auto i = index++;
+            switch (c.encoding_)
+            {
+                case ColumnEncoding::BIT_PACKED:
+                    return c.base + c.values[i];
+                case ColumnEncoding::RUN_LENGTH:
+                    while (i >= run_end)
+                    {
+                        run_end = c.run_ends[run++];
+                    }
+                    return c.base + c.values[run - 1];
+                case ColumnEncoding::DELTA_OF_DELTA:
+                    if (i % BLOCK_SIZE == 0)
+                    {
+                        key = c.checkpoints[2 * (i / BLOCK_SIZE)];
+                        delta = c.checkpoints[2 * (i / BLOCK_SIZE) + 1];
+                    }
+                    else
+                    {
+                        delta += detail::compressed_delta_decode(c.values[i]);
+                        key += delta;
+                    }
+                    return key;
+            }
+            return {};
+        }
+
+      private:
+        const CompressedIntegers* integers{};
+        std::size_t index{};
+        std::size_t run{};
+        std::uint64_t run_end{};
+        std::uint64_t key{};
+        std::uint64_t delta{};
+    };
+
+    CompressedIntegers() = default;
+
+    explicit CompressedIntegers(const std::vector<std::uint64_t>& keys) : size_(keys.size())
+    {
+        if (keys.empty())
+        {
+            return;
+        }
+        const auto [min, max] = std::minmax_element(keys.begin(), keys.end());
+        base = *min;
+        const auto value_width = static_cast<unsigned>(std::bit_width(*max - *min));
+        std::size_t runs{1};
+        unsigned delta_width{};
+        for (std::size_t i = 1; i != keys.size(); ++i)
+        {
+            runs += keys[i] != keys[i - 1] ? 1 : 0;
+            if (i % BLOCK_SIZE != 0)
+            {
+                delta_width = std::max(delta_width, static_cast<unsigned>(std::bit_width(delta_of_delta(keys, i))));
+            }
+        }
+        const auto end_width = static_cast<unsigned>(std::bit_width(keys.size()));
+        const auto bit_packed_size = detail::packed_size_bytes(keys.size(), value_width);
+        const auto run_length_size =
+            detail::packed_size_bytes(runs, value_width) + detail::packed_size_bytes(runs, end_width);
+        const auto delta_of_delta_size = detail::packed_size_bytes(keys.size(), delta_width) +
+                                         (keys.size() + BLOCK_SIZE - 1) / BLOCK_SIZE * 2 * sizeof(std::uint64_t);
+        if (bit_packed_size <= run_length_size && bit_packed_size <= delta_of_delta_size)
+        {
+            encoding_ = ColumnEncoding::BIT_PACKED;
+            values = PackedIntegers{keys.size(), value_width, [&](std::size_t i) { return keys[i] - base; }};
+        }
+        else if (run_length_size <= delta_of_delta_size)
+        {
+            encoding_ = ColumnEncoding::RUN_LENGTH;
+            std::vector<std::uint64_t> run_values;
+            std::vector<std::uint64_t> ends;
+            run_values.reserve(runs);
+            ends.reserve(runs);
+            for (std::size_t i{}; i != keys.size(); ++i)
+            {
+                if (i == 0 || keys[i] != keys[i - 1])
+                {
+                    run_values.push_back(keys[i] - base);
+                    ends.push_back(i + 1);
+                }
+                else
+                {
+                    ++ends.back();
+                }
+            }
+            values = PackedIntegers{runs, value_width, [&](std::size_t i) { return run_values[i]; }};
+            run_ends = PackedIntegers{runs, end_width, [&](std::size_t i) { return ends[i]; }};
+            run_count = runs;
+        }
+        else
+        {
+            encoding_ = ColumnEncoding::DELTA_OF_DELTA;
+            values = PackedIntegers{keys.size(), delta_width,
+                                    [&](std::size_t i) { return i % BLOCK_SIZE == 0 ? 0 : delta_of_delta(keys, i); }};
+            for (std::size_t i{}; i < keys.size(); i += BLOCK_SIZE)
+            {
+                checkpoints.push_back(keys[i]);
+                checkpoints.push_back(i == 0 ? 0 : keys[i] - keys[i - 1]);
+            }
+        }
+    }
+
+    [[nodiscard]] std::uint64_t operator[](std::size_t i) const noexcept
+    {
+        switch (encoding_)
+        {
+            case ColumnEncoding::BIT_PACKED:
+                return base + values[i];
+            case ColumnEncoding::RUN_LENGTH:
+            {
+                std::size_t first{};
+                auto count = run_count;
+                while (count != 0)
+                {
+                    const auto half = count / 2;
+                    if (run_ends[first + half] <= i)
+                    {
+                        first += half + 1;
+                        count -= half + 1;
+                    }
+                    else
+                    {
+                        count = half;
+                    }
+                }
+                return base + values[first];
+            }
+            case ColumnEncoding::DELTA_OF_DELTA:
+            {
+                const auto block = i / BLOCK_SIZE;
+                auto key = checkpoints[2 * block];
+                auto delta = checkpoints[2 * block + 1];
+                for (auto j = block * BLOCK_SIZE + 1; j <= i; ++j)
+                {
+                    delta += detail::compressed_delta_decode(values[j]);
+                    key += delta;
+                }
+                return key;
+            }
+        }
+        return {};
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    [[nodiscard]] std::size_t size_bytes() const noexcept
+    {
+        return values.size_bytes() + run_ends.size_bytes() + checkpoints.size() * sizeof(std::uint64_t);
+    }
+
+    [[nodiscard]] ColumnEncoding encoding() const noexcept { return encoding_; }
+
+  private:
+    static std::uint64_t delta_of_delta(const std::vector<std::uint64_t>& keys, std::size_t i) noexcept
+    {
+        const auto delta = keys[i] - keys[i - 1];
+        const auto previous_delta = i == 1 ? 0 : keys[i - 1] - keys[i - 2];
+        return detail::compressed_delta_encode(delta - previous_delta);
+    }
+
+    ColumnEncoding encoding_{ColumnEncoding::BIT_PACKED};
+    std::size_t size_{};
+    std::size_t run_count{};
+    std::uint64_t base{};
+    PackedIntegers values;
+    PackedIntegers run_ends;
+    std::vector<std::uint64_t> checkpoints;
+};
+
+struct NoDictionary
+{
+};
+}  // namespace detail
+
+// A read-only column of `T` in compressed form. Strings are dictionary-encoded, the dictionary codes and all other
+// values are stored in whichever of the encodings of ltpl::ColumnEncoding is smallest for the data. Values are decoded
+// individually, either by index or in order through the iterators, without decompressing the column.
+template <detail::CompressedElement T>
+class CompressedColumn
+{
+  private:
+    static constexpr bool IS_STRING = std::is_same_v<T, std::string>;
+
+  public:
+    using value_type = T;
+
+    // Strings are returned by reference into the dictionary.
+    using reference = std::conditional_t<IS_STRING, const std::string&, T>;
+
+    class iterator
+    {
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        [[nodiscard]] reference operator*() const noexcept
+        {
+            if constexpr (IS_STRING)
+            {
+                return *current;
+            }
+            else
+            {
+                return current;
+            }
+        }
+
+        iterator& operator++() noexcept
+        {
+            ++index;
+            decode();
+            return *this;
+        }
+
+        void operator++(int) noexcept { ++*this; }
+
+        [[nodiscard]] friend bool operator==(const iterator& it, std::default_sentinel_t) noexcept
+        {
+            return it.index == it.column->size();
+        }
+
+      private:
+        friend CompressedColumn;
+
+        explicit iterator(const CompressedColumn& column) noexcept : column(&column), cursor(column.values)
+        {
+            decode();
+        }
+
+        void decode() noexcept
+        {
+            if (index != column->size())
+            {
+                const auto key = cursor.next();
+                if constexpr (IS_STRING)
+                {
+                    current = &column->dictionary_[key];
+                }
+                else
+                {
+                    current = detail::from_compressed_key<T>(key);
+                }
+            }
+        }
+
+        const CompressedColumn* column{};
+        detail::CompressedIntegers::Cursor cursor;
+        std::size_t index{};
+        std::conditional_t<IS_STRING, const std::string*, T> current{};
+    };
+
+    CompressedColumn() = default;
+
+    explicit CompressedColumn(std::span<const T> values)
+        : CompressedColumn(values.size(), [&](std::size_t i) -> decltype(auto) { return values[i]; })
+    {
+    }
+
+    // Compress the values `value_at(0)`, ..., `value_at(size - 1)`.
+    template <class F>
+    CompressedColumn(std::size_t size, F&& value_at)
+    {
+        std::vector<std::uint64_t> keys(size);
+        if constexpr (IS_STRING)
+        {
+            std::vector<std::string_view> distinct(size);
+            for (std::size_t i{}; i != size; ++i)
+            {
+                distinct[i] = value_at(i);
+            }
+            std::sort(distinct.begin(), distinct.end());
+            distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+            for (std::size_t i{}; i != size; ++i)
+            {
+                keys[i] = static_cast<std::uint64_t>(
+                    std::lower_bound(distinct.begin(), distinct.end(), std::string_view(value_at(i))) -
+                    distinct.begin());
+            }
+            dictionary_.assign(distinct.begin(), distinct.end());
+        }
+        else
+        {
+            for (std::size_t i{}; i != size; ++i)
+            {
+                keys[i] = detail::to_compressed_key<T>(value_at(i));
+            }
+        }
+        values = detail::CompressedIntegers{keys};
+    }
+
+    [[nodiscard]] reference operator[](std::size_t i) const noexcept
+    {
+        if constexpr (IS_STRING)
+        {
+            return dictionary_[values[i]];
+        }
+        else
+        {
+            return detail::from_compressed_key<T>(values[i]);
+        }
+    }
+
+    [[nodiscard]] iterator begin() const noexcept { return iterator{*this}; }
+
+    [[nodiscard]] std::default_sentinel_t end() const noexcept { return {}; }
+
+    [[nodiscard]] std::size_t size() const noexcept { return values.size(); }
+
+    [[nodiscard]] bool empty() const noexcept { return values.size() == 0; }
+
+    // The number of bytes of the compressed values, including the dictionary.
+    [[nodiscard]] std::size_t size_bytes() const noexcept
+    {
+        auto size = values.size_bytes();
+        if constexpr (IS_STRING)
+        {
+            for (const auto& entry : dictionary_)
+            {
+                size += sizeof(entry) + entry.size();
+            }
+        }
+        return size;
+    }
+
+    [[nodiscard]] ColumnEncoding encoding() const noexcept { return values.encoding(); }
+
+    // The distinct strings in ascending order, indexed by the dictionary codes.
+    [[nodiscard]] std::span<const std::string> dictionary() const noexcept  //
+    requires IS_STRING
+    {
+        return dictionary_;
+    }
+
+  private:
+    detail::CompressedIntegers values;
+    [[no_unique_address]] std::conditional_t<IS_STRING, std::vector<std::string>, detail::NoDictionary> dictionary_;
+};
+
+// A read-only batch of Tuples stored as one ltpl::CompressedColumn per element, e.g. for in-memory tables of
+// low-cardinality strings and monotonic timestamps. Rows are decoded individually by index or in order through the
+// iterators, columns can be scanned on their own through ltpl::CompressedTupleBatch::column.
+template <detail::CompressedElement... T>
+class CompressedTupleBatch
+{
+  public:
+    using value_type = ltpl::Tuple<T...>;
+
+    class iterator
+    {
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = ltpl::Tuple<T...>;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        [[nodiscard]] value_type operator*() const
+        {
+            return ltpl::apply([](const auto&... it) { return value_type{*it...}; }, columns);
+        }
+
+        iterator& operator++() noexcept
+        {
+            ++index;
+            ltpl::apply([](auto&... it) { (++it, ...); }, columns);
+            return *this;
+        }
+
+        void operator++(int) noexcept { ++*this; }
+
+        [[nodiscard]] friend bool operator==(const iterator& it, std::default_sentinel_t) noexcept
+        {
+            return it.index == it.size;
+        }
+
+      private:
+        friend CompressedTupleBatch;
+
+        explicit iterator(const CompressedTupleBatch& batch)
+            : columns(ltpl::apply([](const auto&... column)
+                                  { return ltpl::Tuple<typename CompressedColumn<T>::iterator...>{column.begin()...}; },
+                                  batch.columns)),
+              size(batch.size())
+        {
+        }
+
+        ltpl::Tuple<typename CompressedColumn<T>::iterator...> columns;
+        std::size_t index{};
+        std::size_t size{};
+    };
+
+    CompressedTupleBatch() = default;
+
+    explicit CompressedTupleBatch(std::span<const ltpl::Tuple<T...>> rows)
+        : CompressedTupleBatch(rows, std::index_sequence_for<T...>{})
+    {
+    }
+
+    // Compress one vector per column. Returns an empty optional if the columns differ in size.
+    [[nodiscard]] static std::optional<CompressedTupleBatch> from_columns(
+        const ltpl::Tuple<std::vector<T>...>& columns)  //
+    requires(sizeof...(T) != 0)
+    {
+        const auto size = ltpl::get<0>(columns).size();
+        if (!ltpl::apply([&](const auto&... column) { return (true && ... && (column.size() == size)); }, columns))
+        {
+            return std::nullopt;
+        }
+        return CompressedTupleBatch{columns, size, std::index_sequence_for<T...>{}};
+    }
+
+    [[nodiscard]] value_type operator[](std::size_t i) const
+    {
+        return ltpl::apply([&](const auto&... column) { return value_type{column[i]...}; }, columns);
+    }
+
+    template <std::size_t I>
+    [[nodiscard]] const auto& column() const noexcept
+    {
+        return ltpl::get<I>(columns);
+    }
+
+    [[nodiscard]] iterator begin() const { return iterator{*this}; }
+
+    [[nodiscard]] std::default_sentinel_t end() const noexcept { return {}; }
+
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    // The number of bytes of all compressed columns.
+    [[nodiscard]] std::size_t size_bytes() const noexcept
+    {
+        return ltpl::apply([](const auto&... column) { return (std::size_t{} + ... + column.size_bytes()); }, columns);
+    }
+
+  private:
+    template <std::size_t... I>
+    CompressedTupleBatch(std::span<const ltpl::Tuple<T...>> rows, std::index_sequence<I...>)
+        : columns(CompressedColumn<T>{rows.size(),
+                                      [&](std::size_t row) -> const T& { return ltpl::get<I>(rows[row]); }}...),
+          size_(rows.size())
+    {
+    }
+
+    template <std::size_t... I>
+    CompressedTupleBatch(const ltpl::Tuple<std::vector<T>...>& columns, std::size_t size, std::index_sequence<I...>)
+        : columns(CompressedColumn<T>{size, [&](std::size_t row) -> decltype(auto)
+                                      { return ltpl::get<I>(columns)[row]; }}...),
+          size_(size)
+    {
+    }
+
+    ltpl::Tuple<CompressedColumn<T>...> columns;
+    std::size_t size_{};
+};
+}  // namespace ltpl
+
+#endif  // LTPL_LTPL_COMPRESSED_TUPLE_BATCH_HPP
@@ -0,0 +1,330 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_CSV_READER_HPP
+#define LTPL_LTPL_CSV_READER_HPP
+
+#include <ltpl/tuple.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ltpl
+{
+// The outcome of reading a row with ltpl::CsvReader.
+enum class CsvResult
+{
+    ROW,
+    END_OF_INPUT,
+    INVALID_ROW
+};
+
+struct CsvOptions
+{
+    // ',' for CSV, '\t' for TSV.
+    char delimiter{','};
+
+    // Skip the first record.
+    bool has_header{};
+
+    // The initial size of the input buffer, which grows when a single record does not fit.
+    std::size_t buffer_size{64 * 1024};
+};
+
+namespace detail
+{
+#if __cpp_lib_to_chars >= 201611L
+inline constexpr bool HAS_FLOATING_POINT_FROM_CHARS = true;
+#else
+inline constexpr bool HAS_FLOATING_POINT_FROM_CHARS = false;
+#endif
+
+template <class T>
+concept CsvField = std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view> || std::is_integral_v<T> ||
+                   (std::is_floating_point_v<T> && HAS_FLOATING_POINT_FROM_CHARS);
+
+inline constexpr std::uint64_t CSV_LSBS = 0x0101010101010101;
+inline constexpr std::uint64_t CSV_MSBS = 0x8080808080808080;
+
+// The first occurrence of `a` or `b` in [first, last), or `last`. Eight bytes are tested at once using SWAR (SIMD
+// within a register), where the lowest byte of a match is exact.
+inline const char* csv_find_either(const char* first, const char* last, char a, char b) noexcept
+{
+    const auto pattern_a = CSV_LSBS * static_cast<unsigned char>(a);
+    const auto pattern_b = CSV_LSBS * static_cast<unsigned char>(b);
+    for (; last - first >= 8; first += 8)
+    {
+        std::uint64_t word{};
+        for (std::size_t i{}; i != 8; ++i)
+        {
+            word |= std::uint64_t{static_cast<unsigned char>(first[i])} << (i * 8);
+        }
+        const auto x = word ^ pattern_a;
+        const auto y = word ^ pattern_b;
+        const auto match = (((x - CSV_LSBS) & ~x) | ((y - CSV_LSBS) & ~y)) & CSV_MSBS;
+        if (match != 0)
+        {
+            return first + std::countr_zero(match) / 8;
+        }
+    }
+    while (first != last && *first != a && *first != b)
+    {
+        ++first;
+    }
+    return first;
+}
+
+inline const char* csv_find(const char* first, const char* last, char c) noexcept
+{
+    const auto* found = std::memchr(first, c, static_cast<std::size_t>(last - first));
+    return found != nullptr ? static_cast<const char*>(found) : last;
+}
+
+template <class T>
+bool csv_parse_value(const char* first, const char* last, T& value)
+{
+    if constexpr (std::is_same_v<T, std::string>)
+    {
+        value.assign(first, last);
+        return true;
+    }
+    else if constexpr (std::is_same_v<T, std::string_view>)
+    {
+        value = std::string_view(first, static_cast<std::size_t>(last - first));
+        return true;
+    }
+    else if constexpr (std::is_same_v<T, bool>)
+    {
+        const std::string_view field(first, static_cast<std::size_t>(last - first));
+        value = field == "1" || field == "true";
+        return value || field == "0" || field == "false";
+    }
+    else
+    {
+        const auto [end, error] = std::from_chars(first, last, value);
+        return error == std::errc{} && end == last;
+    }
+}
+
+// Parse the field that starts at `position` and advance past its delimiter. Quoted fields are unescaped in place.
+template <class T>
+bool csv_parse_field(char*& position, char* last, char delimiter, bool is_last_field, T& value)
+{
+    char* first = position;
+    char* field_last;
+    if (position != last && *position == '"')
+    {
+        field_last = first;
+        ++position;
+        for (;;)
+        {
+            if (position == last)
+            {
+                return false;
+            }
+            if (*position == '"')
+            {
+                if (position + 1 == last || position[1] != '"')
+                {
+                    ++position;
+                    break;
+                }
+                ++position;
+            }
+            *field_last++ = *position++;
+        }
+    }
+    else
+    {
+        position += detail::csv_find(position, last, delimiter) - position;
+        field_last = position;
+    }
+    if (is_last_field ? position != last : position == last || *position != delimiter)
+    {
+        return false;
+    }
+    if (!is_last_field)
+    {
+        ++position;
+    }
+    return detail::csv_parse_value(first, field_last, value);
+}
+}  // namespace detail
+
+// Reads rows of delimiter-separated values from a stream directly into Tuples. Every record must have one field per
+// element, integers and floating point numbers are parsed with `std::from_chars`, `bool` accepts `0`, `1`, `false` and
+// `true`. Fields may be quoted with `"`, in which case they can contain delimiters, newlines and `""` for a quote.
+// Lines ending in `\r\n` and blank lines are supported. The input is read in chunks into a buffer that is reused for
+// all rows, so that reading a row does not allocate unless a `std::string` element grows. `std::string_view` elements
+// refer to that buffer and remain valid until the next read.
+template <detail::CsvField... T>
+class CsvReader
+{
+  public:
+    explicit CsvReader(std::istream& input, CsvOptions options = {})
+        : input(&input),
+          buffer(std::max(options.buffer_size, std::size_t{1})),
+          delimiter(options.delimiter),
+          skip_header(options.has_header)
+    {
+    }
+
+    // Returns ROW and assigns all elements of `row` on success. After INVALID_ROW the elements of `row` are unspecified
+    // and the next call continues with the following record.
+    [[nodiscard]] CsvResult read(ltpl::Tuple<T...>& row)
+    {
+        char* first;
+        char* last;
+        for (;;)
+        {
+            if (!next_record(first, last))
+            {
+                return CsvResult::END_OF_INPUT;
+            }
+            ++record_number_;
+            if (std::exchange(skip_header, false))
+            {
+                continue;
+            }
+            if (first != last && last[-1] == '\r')
+            {
+                --last;
+            }
+            if (first != last)
+            {
+                break;
+            }
+        }
+        const bool valid = ltpl::apply(
+            [&](auto&... v)
+            {
+                std::size_t index{};
+                return (true && ... &&
+                        detail::csv_parse_field(first, last, delimiter, ++index == sizeof...(T), v));
+            },
+            row);
+        return valid ? CsvResult::ROW : CsvResult::INVALID_ROW;
+    }
+
+    // Append up to `max_rows` rows to `columns`, one vector per element. Returns ROW if `max_rows` rows have been
+    // appended, END_OF_INPUT if the input ended before and INVALID_ROW if a record could not be parsed, in which case
+    // the rows before it have been appended.
+    [[nodiscard]] CsvResult read_columns(ltpl::Tuple<std::vector<T>...>& columns, std::size_t max_rows)  //
+    requires((!std::is_same_v<T, std::string_view> && ...))
+    {
+        for (std::size_t i{}; i != max_rows; ++i)
+        {
+            const auto result = read(scratch);
+            if (result != CsvResult::ROW)
+            {
+                return result;
+            }
+            [&]<std::size_t... I>(std::index_sequence<I...>)
+            {
+                (ltpl::get<I>(columns).push_back(std::move(ltpl::get<I>(scratch))), ...);
+            }(std::index_sequence_for<T...>{});
+        }
+        return CsvResult::ROW;
+    }
+
+    // The 1-based number of the last record that has been read, including the header.
+    [[nodiscard]] std::size_t record_number() const noexcept { return record_number_; }
+
+  private:
+    // Find the next complete record in the buffer, refilling and growing it as needed. A newline only ends a record
+    // outside of quoted fields. Like in csv_parse_field, only a quote at the start of a field opens a quoted field, so
+    // that a stray quote inside of an unquoted field cannot swallow the following records.
+    bool next_record(char*& first, char*& last)
+    {
+        for (;;)
+        {
+            char* data = buffer.data();
+            const char* end = data + end_;
+            const char* record = data + begin_;
+            const char* position = record;
+            bool quoted{};
+            for (;;)
+            {
+                position = quoted ? detail::csv_find(position, end, '"')
+                                  : detail::csv_find_either(position, end, '\n', '"');
+                if (position == end || *position == '\n')
+                {
+                    break;
+                }
+                if (quoted)
+                {
+                    // `""` is an escaped quote and does not end the quoted field.
+                    quoted = position + 1 != end && position[1] == '"';
+                    position += quoted ? 2 : 1;
+                }
+                else
+                {
+                    quoted = position == record || position[-1] == delimiter;
+                    ++position;
+                }
+            }
+            if (position != end)
+            {
+                const auto record_end = static_cast<std::size_t>(position - data);
+                first = data + begin_;
+                last = data + record_end;
+                begin_ = record_end + 1;
+                return true;
+            }
+            if (end_of_input)
+            {
+                if (begin_ == end_)
+                {
+                    return false;
+                }
+                first = data + begin_;
+                last = data + end_;
+                begin_ = end_;
+                return true;
+            }
+            fill();
+        }
+    }
+
+    void fill()
+    {
+        std::copy(buffer.begin() + static_cast<std::ptrdiff_t>(begin_),
+                  buffer.begin() + static_cast<std::ptrdiff_t>(end_), buffer.begin());
+        end_ -= begin_;
+        begin_ = 0;
+        if (end_ == buffer.size())
+        {
+            buffer.resize(2 * buffer.size());
+        }
+        input->read(buffer.data() + end_, static_cast<std::streamsize>(buffer.size() - end_));
+        const auto count = static_cast<std::size_t>(input->gcount());
+        end_ += count;
+        end_of_input = count == 0;
+    }
+
+    std::istream* input;
+    std::vector<char> buffer;
+    std::size_t begin_{};
+    std::size_t end_{};
+    std::size_t record_number_{};
+    char delimiter;
+    bool skip_header;
+    bool end_of_input{};
+    ltpl::Tuple<T...> scratch;
+};
+}  // namespace ltpl
+
+#endif  // LTPL_LTPL_CSV_READER_HPP
@@ -0,0 +1,462 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_FLAT_TUPLE_MAP_HPP
+#define LTPL_LTPL_FLAT_TUPLE_MAP_HPP
+
+#include <ltpl/hash.hpp>
+#include <ltpl/tuple.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ltpl
+{
+template <class Key, class V>
+class FlatTupleMap;
+
+namespace detail
+{
+// Every slot has one control byte. Full slots store the low 7 bits of the hash, so that most mismatches are rejected
+// without touching the slot.
+inline constexpr std::uint8_t CONTROL_EMPTY = 0x80;
+inline constexpr std::uint8_t CONTROL_DELETED = 0xFE;
+inline constexpr std::size_t CONTROL_GROUP_WIDTH = 8;
+inline constexpr std::uint64_t CONTROL_LSBS = 0x0101010101010101;
+inline constexpr std::uint64_t CONTROL_MSBS = 0x8080808080808080;
+
+// Eight control bytes that are matched against a value at once using SWAR (SIMD within a register). The result of a
+// match has the most significant bit of every matching byte set.
+class ControlGroup
+{
+  public:
+    explicit ControlGroup(const std::uint8_t* control) noexcept
+    {
+        for (std::size_t i{}; i != CONTROL_GROUP_WIDTH; ++i)
+        {
+            word |= std::uint64_t{control[i]} << (i * 8);
+        }
+    }
+
+    // May report false positives for bytes that follow a match, callers verify every match.
+    [[nodiscard]] std::uint64_t match(std::uint8_t h2) const noexcept
+    {
+        const auto x = word ^ (CONTROL_LSBS * h2);
+        return (x - CONTROL_LSBS) & ~x & CONTROL_MSBS;
+    }
+
+    [[nodiscard]] std::uint64_t match_empty() const noexcept { return word & ~(word << 6) & CONTROL_MSBS; }
+
+    [[nodiscard]] std::uint64_t match_empty_or_deleted() const noexcept
+    {
+        return word & ~(word << 7) & CONTROL_MSBS;
+    }
+
+    [[nodiscard]] static std::size_t first(std::uint64_t match) noexcept
+    {
+        return static_cast<std::size_t>(std::countr_zero(match)) / 8;
+    }
+
+    [[nodiscard]] static std::uint64_t next(std::uint64_t match) noexcept { return match & (match - 1); }
+
+  private:
+    std::uint64_t word{};
+};
+
+template <class Key, class V>
+struct FlatTupleMapSlot
+{
+    std::size_t hash;
+    Key key;
+    V value;
+};
+
+template <class Key, class Tuple>
+inline constexpr bool is_flat_tuple_map_key_v = false;
+
+template <class... K, class... U>
+inline constexpr bool is_flat_tuple_map_key_v<ltpl::Tuple<K...>, ltpl::Tuple<U...>> = []
+{
+    if constexpr (sizeof...(K) == sizeof...(U))
+    {
+        return (std::is_same_v<K, std::remove_cvref_t<U>> && ... && true);
+    }
+    else
+    {
+        return false;
+    }
+}();
+
+// Lookup keys must hash and compare like the stored keys. This is guaranteed for Tuples whose elements are references
+// to or values of the key types, because `std::hash<ltpl::Tuple>` ignores references.
+template <class Tuple, class Key>
+concept FlatTupleMapKey = is_flat_tuple_map_key_v<Key, std::remove_cvref_t<Tuple>>;
+}  // namespace detail
+
+// An open addressing hash map from Tuples to values. Keys, values and their hashes are stored inline in a single array
+// that is probed in groups of eight control bytes. Lookup accepts any Tuple of (references to) the key types, e.g.
+// `map.find(ltpl::forward_as_tuple(a, b))`, without constructing a key. Insertion and rehashing invalidate iterators
+// and references.
+template <class... K, class V>
+class FlatTupleMap<ltpl::Tuple<K...>, V>
+{
+  private:
+    using Slot = detail::FlatTupleMapSlot<ltpl::Tuple<K...>, V>;
+
+  public:
+    using key_type = ltpl::Tuple<K...>;
+    using mapped_type = V;
+    using size_type = std::size_t;
+
+  private:
+    template <bool Const>
+    class Iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ltpl::Tuple<const key_type&, std::conditional_t<Const, const V&, V&>>;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type;
+
+        Iterator() = default;
+
+        template <bool OtherConst>
+        Iterator(const Iterator<OtherConst>& other) noexcept  //
+        requires(Const && !OtherConst)
+            : map(other.map), index(other.index)
+        {
+        }
+
+        [[nodiscard]] reference operator*() const noexcept
+        {
+            Slot& slot = map->slots[index];
+            return reference{slot.key, slot.value};
+        }
+
+        Iterator& operator++() noexcept
+        {
+            index = map->next_full(index + 1);
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        [[nodiscard]] friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept
+        {
+            return lhs.index == rhs.index;
+        }
+
+      private:
+        friend FlatTupleMap;
+
+        template <bool>
+        friend class Iterator;
+
+        Iterator(const FlatTupleMap* map, std::size_t index) noexcept : map(map), index(index) {}
+
+        const FlatTupleMap* map{};
+        std::size_t index{};
+    };
+
+  public:
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    FlatTupleMap() = default;
+
+    FlatTupleMap(const FlatTupleMap& other) : FlatTupleMap()
+    {
+        reserve(other.size());
+        for (auto&& [key, value] : other)
+        {
+            emplace_new(std::hash<key_type>{}(key), key, value);
+        }
+    }
+
+    FlatTupleMap(FlatTupleMap&& other) noexcept
+        : control(std::exchange(other.control, nullptr)),
+          slots(std::exchange(other.slots, nullptr)),
+          capacity_(std::exchange(other.capacity_, 0)),
+          size_(std::exchange(other.size_, 0)),
+          growth_left(std::exchange(other.growth_left, 0))
+    {
+    }
+
+    ~FlatTupleMap() { deallocate(); }
+
+    FlatTupleMap& operator=(const FlatTupleMap& other)
+    {
+        if (this != &other)
+        {
+            FlatTupleMap copy{other};
+            swap(*this, copy);
+        }
+        return *this;
+    }
+
+    FlatTupleMap& operator=(FlatTupleMap&& other) noexcept
+    {
+        FlatTupleMap moved{std::move(other)};
+        swap(*this, moved);
+        return *this;
+    }
+
+    friend void swap(FlatTupleMap& lhs, FlatTupleMap& rhs) noexcept
+    {
+        std::swap(lhs.control, rhs.control);
+        std::swap(lhs.slots, rhs.slots);
+        std::swap(lhs.capacity_, rhs.capacity_);
+        std::swap(lhs.size_, rhs.size_);
+        std::swap(lhs.growth_left, rhs.growth_left);
+    }
+
+    [[nodiscard]] iterator begin() noexcept { return iterator{this, next_full(0)}; }
+
+    [[nodiscard]] const_iterator begin() const noexcept { return const_iterator{this, next_full(0)}; }
+
+    [[nodiscard]] iterator end() noexcept { return iterator{this, capacity_}; }
+
+    [[nodiscard]] const_iterator end() const noexcept { return const_iterator{this, capacity_}; }
+
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+    // Ensure that `count` elements can be stored without rehashing.
+    void reserve(std::size_t count)
+    {
+        if (count > size_ + growth_left)
+        {
+            rehash(capacity_for(count));
+        }
+    }
+
+    void clear() noexcept
+    {
+        FlatTupleMap empty;
+        swap(*this, empty);
+    }
+
+    template <detail::FlatTupleMapKey<key_type> Tuple>
+    [[nodiscard]] iterator find(const Tuple& key)
+    {
+        return iterator{this, find_index(std::hash<std::remove_cvref_t<Tuple>>{}(key), key)};
+    }
+
+    template <detail::FlatTupleMapKey<key_type> Tuple>
+    [[nodiscard]] const_iterator find(const Tuple& key) const
+    {
+        return const_iterator{this, find_index(std::hash<std::remove_cvref_t<Tuple>>{}(key), key)};
+    }
+
+    template <detail::FlatTupleMapKey<key_type> Tuple>
+    [[nodiscard]] bool contains(const Tuple& key) const
+    {
+        return find(key) != end();
+    }
+
+    // Insert a value constructed from `args...` unless the key already exists. The key is only constructed from `key`
+    // if it is inserted.
+    template <detail::FlatTupleMapKey<key_type> Tuple, class... Args>
+    std::pair<iterator, bool> try_emplace(Tuple&& key, Args&&... args)
+    {
+        const auto hash = std::hash<std::remove_cvref_t<Tuple>>{}(key);
+        if (const auto index = find_index(hash, key); index != capacity_)
+        {
+            return {iterator{this, index}, false};
+        }
+        const auto index = emplace_new(hash, static_cast<Tuple&&>(key), static_cast<Args&&>(args)...);
+        return {iterator{this, index}, true};
+    }
+
+    template <detail::FlatTupleMapKey<key_type> Tuple>
+    V& operator[](Tuple&& key)
+    {
+        const auto [it, inserted] = try_emplace(static_cast<Tuple&&>(key));
+        return slots[it.index].value;
+    }
+
+    // Erase the element with the given key and return the number of erased elements.
+    template <detail::FlatTupleMapKey<key_type> Tuple>
+    std::size_t erase(const Tuple& key)
+    {
+        const auto index = find_index(std::hash<std::remove_cvref_t<Tuple>>{}(key), key);
+        if (index == capacity_)
+        {
+            return 0;
+        }
+        std::destroy_at(slots + index);
+        set_control(index, detail::CONTROL_DELETED);
+        --size_;
+        return 1;
+    }
+
+  private:
+    static std::size_t max_load(std::size_t capacity) noexcept { return capacity - capacity / 8; }
+
+    static std::size_t capacity_for(std::size_t count) noexcept
+    {
+        std::size_t capacity = detail::CONTROL_GROUP_WIDTH;
+        while (max_load(capacity) < count)
+        {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    static std::uint8_t h2(std::size_t hash) noexcept { return static_cast<std::uint8_t>(hash & 0x7F); }
+
+    // The control bytes of the first group are mirrored after the last slot, so that every group can be loaded without
+    // wrapping around.
+    void set_control(std::size_t index, std::uint8_t value) noexcept
+    {
+        control[index] = value;
+        if (index < detail::CONTROL_GROUP_WIDTH)
+        {
+            control[capacity_ + index] = value;
+        }
+    }
+
+    template <class Tuple>
+    std::size_t find_index(std::size_t hash, const Tuple& key) const
+    {
+        if (capacity_ == 0)
+        {
+            return capacity_;
+        }
+        const auto mask = capacity_ - 1;
+        auto position = (hash >> 7) & mask;
+        for (std::size_t step = detail::CONTROL_GROUP_WIDTH;; step += detail::CONTROL_GROUP_WIDTH)
+        {
+            const detail::ControlGroup group{control + position};
+            for (auto match = group.match(h2(hash)); match != 0; match = detail::ControlGroup::next(match))
+            {
+                const auto index = (position + detail::ControlGroup::first(match)) & mask;
+                if (slots[index].hash == hash && slots[index].key == key)
+                {
+                    return index;
+                }
+            }
+            if (group.match_empty() != 0)
+            {
+                return capacity_;
+            }
+            position = (position + step) & mask;
+        }
+    }
+
+    std::size_t find_insert_index(std::size_t hash) const noexcept
+    {
+        const auto mask = capacity_ - 1;
+        auto position = (hash >> 7) & mask;
+        for (std::size_t step = detail::CONTROL_GROUP_WIDTH;; step += detail::CONTROL_GROUP_WIDTH)
+        {
+            const detail::ControlGroup group{control + position};
+            if (const auto match = group.match_empty_or_deleted(); match != 0)
+            {
+                return (position + detail::ControlGroup::first(match)) & mask;
+            }
+            position = (position + step) & mask;
+        }
+    }
+
+    template <class Tuple, class... Args>
+    std::size_t emplace_new(std::size_t hash, Tuple&& key, Args&&... args)
+    {
+        if (growth_left == 0)
+        {
+            // Reclaim deleted slots in place if they make up a large part of the table, otherwise grow.
+            rehash(size_ < max_load(capacity_) / 2 ? capacity_for(size_ + 1)
+                                                   : std::max(detail::CONTROL_GROUP_WIDTH, 2 * capacity_));
+        }
+        const auto index = find_insert_index(hash);
+        ::new (static_cast<void*>(slots + index))
+            Slot{hash, key_type(static_cast<Tuple&&>(key)), V(static_cast<Args&&>(args)...)};
+        if (control[index] == detail::CONTROL_EMPTY)
+        {
+            --growth_left;
+        }
+        set_control(index, h2(hash));
+        ++size_;
+        return index;
+    }
+
+    void rehash(std::size_t new_capacity)
+    {
+        FlatTupleMap other;
+        other.allocate(new_capacity);
+        for (std::size_t i{}; i != capacity_; ++i)
+        {
+            if (control[i] < detail::CONTROL_EMPTY)
+            {
+                const auto index = other.find_insert_index(slots[i].hash);
+                ::new (static_cast<void*>(other.slots + index)) Slot{std::move(slots[i])};
+                other.set_control(index, control[i]);
+                ++other.size_;
+                --other.growth_left;
+            }
+        }
+        swap(*this, other);
+    }
+
+    void allocate(std::size_t capacity)
+    {
+        control = new std::uint8_t[capacity + detail::CONTROL_GROUP_WIDTH];
+        std::uninitialized_fill_n(control, capacity + detail::CONTROL_GROUP_WIDTH, detail::CONTROL_EMPTY);
+        slots = std::allocator<Slot>{}.allocate(capacity);
+        capacity_ = capacity;
+        growth_left = max_load(capacity);
+    }
+
+    void deallocate() noexcept
+    {
+        if (capacity_ == 0)
+        {
+            return;
+        }
+        for (std::size_t i{}; i != capacity_; ++i)
+        {
+            if (control[i] < detail::CONTROL_EMPTY)
+            {
+                std::destroy_at(slots + i);
+            }
+        }
+        std::allocator<Slot>{}.deallocate(slots, capacity_);
+        delete[] control;
+    }
+
+    std::size_t next_full(std::size_t index) const noexcept
+    {
+        while (index < capacity_ && control[index] >= detail::CONTROL_EMPTY)
+        {
+            ++index;
+        }
+        return index;
+    }
+
+    std::uint8_t* control{};
+    Slot* slots{};
+    std::size_t capacity_{};
+    std::size_t size_{};
+    std::size_t growth_left{};
+};
+}  // namespace ltpl
+
+#endif  // LTPL_LTPL_FLAT_TUPLE_MAP_HPP
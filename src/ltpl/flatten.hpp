@@ -0,0 +1,123 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_FLATTEN_HPP
+#define LTPL_LTPL_FLATTEN_HPP
+
+#include <ltpl/tuple.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ltpl
+{
+namespace detail
+{
+template <class... Paths>
+struct PathList
+{
+    template <class... U>
+    friend constexpr PathList<Paths..., U...> operator+(PathList, PathList<U...>) noexcept
+    {
+        return {};
+    }
+};
+
+template <std::size_t I, std::size_t... Path>
+std::index_sequence<I, Path...> prepend_path(std::index_sequence<Path...>);
+
+template <std::size_t I, class... Paths>
+PathList<decltype(detail::prepend_path<I>(Paths{}))...> prepend_paths(PathList<Paths...>);
+
+// The paths to all leaves of T. A leaf is every element that is not a by-value Tuple. The recursion depth of this
+// template is bounded by the nesting depth of the Tuples, not by their sizes.
+template <class T>
+struct LeafPaths
+{
+    using Type = PathList<std::index_sequence<>>;
+};
+
+template <class... T>
+struct LeafPaths<ltpl::Tuple<T...>>
+{
+    template <std::size_t... I>
+    static auto paths(std::index_sequence<I...>)
+        -> decltype((PathList<>{} + ... + detail::prepend_paths<I>(typename LeafPaths<T>::Type{})));
+
+    using Type = decltype(paths(std::index_sequence_for<T...>{}));
+};
+
+template <class T, class Path>
+struct ElementAtPath;
+
+template <class T>
+struct ElementAtPath<T, std::index_sequence<>>
+{
+    using Type = T;
+};
+
+template <class T, std::size_t I, std::size_t... Path>
+struct ElementAtPath<T, std::index_sequence<I, Path...>>
+{
+    using Type = typename ElementAtPath<std::tuple_element_t<I, T>, std::index_sequence<Path...>>::Type;
+};
+
+template <class Tuple, class Paths>
+struct FlatTuple;
+
+template <class Tuple, class... Paths>
+struct FlatTuple<Tuple, PathList<Paths...>>
+{
+    using Type = ltpl::Tuple<typename ElementAtPath<Tuple, Paths>::Type...>;
+};
+
+template <class Tuple>
+using FlatTupleOfT = typename FlatTuple<Tuple, typename LeafPaths<Tuple>::Type>::Type;
+}  // namespace detail
+
+// The Tuple of all leaf elements of T..., where by-value Tuples are expanded recursively, e.g.
+// `flat_tuple_t<Tuple<A, B>, Tuple<C, Tuple<D, E>>>` is `Tuple<A, B, C, D, E>`.
+template <class... T>
+using flat_tuple_t = detail::FlatTupleOfT<ltpl::Tuple<T...>>;
+
+// Obtain the element of nested Tuples at the given path of indices, e.g. `get_path<1, 0>(tuple)` is
+// `get<0>(get<1>(tuple))`. The result has the same value category that ltpl::get would return for the last Tuple.
+template <std::size_t I, std::size_t... Path, detail::IsTuple Tuple>
+[[nodiscard]] constexpr decltype(auto) get_path(Tuple&& tuple) noexcept
+{
+    if constexpr (sizeof...(Path) == 0)
+    {
+        return ltpl::get<I>(static_cast<Tuple&&>(tuple));
+    }
+    else
+    {
+        return ltpl::get_path<Path...>(ltpl::get<I>(static_cast<Tuple&&>(tuple)));
+    }
+}
+
+namespace detail
+{
+template <std::size_t... Path, class Tuple>
+constexpr decltype(auto) get_path(std::index_sequence<Path...>, Tuple&& tuple) noexcept
+{
+    return ltpl::get_path<Path...>(static_cast<Tuple&&>(tuple));
+}
+}  // namespace detail
+
+// Create a Tuple of all leaf elements of a nested Tuple, see ltpl::flat_tuple_t. Elements are moved from rvalue Tuples
+// and copied from lvalue Tuples. Every leaf is initialized directly from its position in the nested Tuple.
+template <detail::IsTuple Tuple>
+[[nodiscard]] constexpr detail::FlatTupleOfT<std::remove_cvref_t<Tuple>> flatten(Tuple&& tuple)
+{
+    using Result = detail::FlatTupleOfT<std::remove_cvref_t<Tuple>>;
+    return [&]<class... Paths>(detail::PathList<Paths...>)
+    {
+        return Result(detail::get_path(Paths{}, static_cast<Tuple&&>(tuple))...);
+    }(typename detail::LeafPaths<std::remove_cvref_t<Tuple>>::Type{});
+}
+}  // namespace ltpl
+
+#endif  // LTPL_LTPL_FLATTEN_HPP
@@ -0,0 +1,282 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_FUNCTIONAL_HPP
+#define LTPL_LTPL_FUNCTIONAL_HPP
+
+#include <ltpl/hash.hpp>
+#include <ltpl/tuple.hpp>
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ltpl
+{
+namespace detail
+{
+// ltpl::Tuple, std::tuple, std::pair, std::array and anything else that supports structured bindings through
+// `std::tuple_size` and a `get` function.
+template <class T>
+concept TupleLikeObject = requires { std::tuple_size<std::remove_cvref_t<T>>::value; };
+
+template <class T>
+inline constexpr std::size_t tuple_like_object_size_v = std::tuple_size<std::remove_cvref_t<T>>::value;
+
+template <std::size_t I, class T>
+constexpr decltype(auto) get_tuple_like(const T& tuple) noexcept
+{
+    if constexpr (IsTuple<T>)
+    {
+        return ltpl::get<I>(tuple);
+    }
+    else
+    {
+        using std::get;
+        return get<I>(tuple);
+    }
+}
+
+template <std::size_t I, class T>
+using TupleLikeElementT = decltype(detail::get_tuple_like<I>(std::declval<const T&>()));
+
+template <class Lhs, class Rhs, class Predicate>
+constexpr bool all_tuple_like_elements()
+{
+    if constexpr (tuple_like_object_size_v<Lhs> != tuple_like_object_size_v<Rhs>)
+    {
+        return false;
+    }
+    else
+    {
+        return []<std::size_t... I>(std::index_sequence<I...>)
+        {
+            return (true && ... &&
+                    Predicate::template value<TupleLikeElementT<I, Lhs>, TupleLikeElementT<I, Rhs>>);
+        }(std::make_index_sequence<tuple_like_object_size_v<Lhs>>{});
+    }
+}
+
+struct IsEqualityComparable
+{
+    template <class T, class U>
+    static constexpr bool value = WeaklyEqualityComparableWith<T, U>;
+};
+
+struct IsThreeWayComparable
+{
+    template <class T, class U>
+    static constexpr bool value = SynthThreeWayComparableWith<T, U>;
+};
+
+template <class Lhs, class Rhs>
+concept TupleLikeEqualityComparable = TupleLikeObject<Lhs> && TupleLikeObject<Rhs> &&
+                                      detail::all_tuple_like_elements<Lhs, Rhs, IsEqualityComparable>();
+
+template <class Lhs, class Rhs>
+concept TupleLikeThreeWayComparable = TupleLikeObject<Lhs> && TupleLikeObject<Rhs> &&
+                                      detail::all_tuple_like_elements<Lhs, Rhs, IsThreeWayComparable>();
+
+template <class Lhs, class Rhs>
+constexpr auto tuple_like_three_way(const Lhs& lhs, const Rhs& rhs)
+{
+    return [&]<std::size_t... I>(std::index_sequence<I...>)
+    {
+        std::common_comparison_category_t<SynthThreeWayResultT<TupleLikeElementT<I, Lhs>, TupleLikeElementT<I, Rhs>>...>
+            result = std::strong_ordering::equal;
+        (void)(true && ... &&
+               ((result = detail::synth_three_way(detail::get_tuple_like<I>(lhs), detail::get_tuple_like<I>(rhs))) ==
+                0));
+        return result;
+    }(std::make_index_sequence<tuple_like_object_size_v<Lhs>>{});
+}
+
+// Strings, string views and C-strings that compare equal must hash equally.
+template <class T>
+std::size_t transparent_element_hash(const T& v) noexcept
+{
+    if constexpr (std::is_convertible_v<const T&, std::string_view>)
+    {
+        return std::hash<std::string_view>{}(std::string_view(v));
+    }
+    else
+    {
+        return std::hash<T>{}(v);
+    }
+}
+}  // namespace detail
+
+// Transparent function objects for ordered and unordered containers of Tuples. They compare and hash any two
+// tuple-like objects element-wise, e.g. a `Tuple<std::string, int>` key against a `Tuple<std::string_view, int>`,
+// a `Tuple<const std::string&, int>` or a `std::tuple<std::string_view, int>`, so that lookups do not have to construct
+// a key.
+struct transparent_less
+{
+    using is_transparent = void;
+
+    template <class Lhs, class Rhs>
+    requires detail::TupleLikeThreeWayComparable<Lhs, Rhs>
+    [[nodiscard]] constexpr bool operator()(const Lhs& lhs, const Rhs& rhs) const
+    {
+        return detail::tuple_like_three_way(lhs, rhs) < 0;
+    }
+};
+
+struct transparent_equal
+{
+    using is_transparent = void;
+
+    template <class Lhs, class Rhs>
+    requires detail::TupleLikeEqualityComparable<Lhs, Rhs>
+    [[nodiscard]] constexpr bool operator()(const Lhs& lhs, const Rhs& rhs) const
+    {
+        return [&]<std::size_t... I>(std::index_sequence<I...>)
+        {
+            return (true && ... && (detail::get_tuple_like<I>(lhs) == detail::get_tuple_like<I>(rhs)));
+        }(std::make_index_sequence<detail::tuple_like_object_size_v<Lhs>>{});
+    }
+};
+
+// Elements that are convertible to `std::string_view` are hashed as such, all other elements with `std::hash`. The
+// result therefore only depends on the values of the elements, not on the kind of tuple or the string type.
+struct transparent_hash
+{
+    using is_transparent = void;
+
+    template <detail::TupleLikeObject T>
+    [[nodiscard]] std::size_t operator()(const T& tuple) const noexcept
+    {
+        return [&]<std::size_t... I>(std::index_sequence<I...>)
+        {
+            std::uint64_t seed{};
+            ((seed = detail::hash_combine(
+                  seed, detail::transparent_element_hash(
+                            static_cast<const std::remove_cvref_t<detail::TupleLikeElementT<I, T>>&>(
+                                detail::get_tuple_like<I>(tuple))))),
+             ...);
+            return static_cast<std::size_t>(seed);
+        }(std::make_index_sequence<detail::tuple_like_object_size_v<T>>{});
+    }
+};
+
+// Sort keys for ltpl::order_by: the element at index I in ascending or descending order.
+template <std::size_t I>
+struct asc
+{
+    static constexpr std::size_t index = I;
+    static constexpr bool descending = false;
+};
+
+template <std::size_t I>
+struct desc
+{
+    static constexpr std::size_t index = I;
+    static constexpr bool descending = true;
+};
+
+namespace detail
+{
+template <class Key, class Lhs, class Rhs>
+constexpr auto order_key_three_way(const Lhs& lhs, const Rhs& rhs)
+{
+    if constexpr (Key::descending)
+    {
+        return detail::synth_three_way(rhs, lhs);
+    }
+    else
+    {
+        return detail::synth_three_way(lhs, rhs);
+    }
+}
+
+template <class Key, class... T>
+using OrderKeyElementT = std::tuple_element_t<Key::index, ltpl::Tuple<T...>>;
+
+template <class Key, class TupleList, class UList>
+inline constexpr bool is_order_key_for_v = false;
+
+template <class Key, class... T, class... U>
+inline constexpr bool is_order_key_for_v<Key, TypeList<T...>, TypeList<U...>> = []
+{
+    if constexpr (Key::index < sizeof...(T) && Key::index < sizeof...(U))
+    {
+        return SynthThreeWayComparableWith<OrderKeyElementT<Key, T...>, OrderKeyElementT<Key, U...>>;
+    }
+    else
+    {
+        return false;
+    }
+}();
+}  // namespace detail
+
+// Compare Tuples lexicographically by a subset of their elements, each in ascending or descending order, e.g.
+// `order_by<desc<3>, asc<0>>` sorts by the fourth element in descending order and then by the first in ascending
+// order. The storage lambda of each Tuple is invoked only once per comparison.
+template <class... Keys>
+struct order_by
+{
+    template <class... T, class... U>
+    requires(detail::is_order_key_for_v<Keys, detail::TypeList<T...>, detail::TypeList<U...>> && ... && true)
+    [[nodiscard]] constexpr bool operator()(const ltpl::Tuple<T...>& lhs, const ltpl::Tuple<U...>& rhs) const
+    {
+        return ltpl::apply(
+            [&](const auto&... v_lhs)
+            {
+                return ltpl::apply(
+                    [&](const auto&... v_rhs)
+                    {
+                        bool less{};
+                        (void)(false || ... ||
+                               [&](auto order)
+                               {
+                                   less = order < 0;
+                                   return order != 0;
+                               }(detail::order_key_three_way<Keys>(detail::get_nth<Keys::index>(v_lhs...),
+                                                                   detail::get_nth<Keys::index>(v_rhs...))));
+                        return less;
+                    },
+                    rhs);
+            },
+            lhs);
+    }
+};
+
+// Compare Tuples lexicographically by the elements at indices I... in ascending order.
+template <std::size_t... I>
+using less_by = order_by<asc<I>...>;
+
+// Compare Tuples lexicographically by the elements at indices I... in descending order.
+template <std::size_t... I>
+using greater_by = order_by<desc<I>...>;
+
+// Compare the elements at indices I... of two Tuples for equality.
+template <std::size_t... I>
+struct equal_by
+{
+    template <class... T, class... U>
+    requires((I < sizeof...(T) && I < sizeof...(U)) && ... && true)
+    [[nodiscard]] constexpr bool operator()(const ltpl::Tuple<T...>& lhs, const ltpl::Tuple<U...>& rhs) const
+    {
+        return ltpl::apply(
+            [&](const auto&... v_lhs)
+            {
+                return ltpl::apply(
+                    [&](const auto&... v_rhs)
+                    {
+                        return (true && ... && (detail::get_nth<I>(v_lhs...) == detail::get_nth<I>(v_rhs...)));
+                    },
+                    rhs);
+            },
+            lhs);
+    }
+};
+}  // namespace ltpl
+
+#endif  // LTPL_LTPL_FUNCTIONAL_HPP
@@ -0,0 +1,152 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_HASH_HPP
+#define LTPL_LTPL_HASH_HPP
+
+#include <ltpl/tuple.hpp>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <type_traits>
+
+namespace ltpl
+{
+namespace detail
+{
+inline constexpr std::uint64_t HASH_SEED = 0x9e3779b97f4a7c15;
+
+// The finalizer of MurmurHash3, every input bit affects every output bit.
+constexpr std::uint64_t hash_mix(std::uint64_t h) noexcept
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccd;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53;
+    h ^= h >> 33;
+    return h;
+}
+
+constexpr std::uint64_t hash_combine(std::uint64_t seed, std::uint64_t value) noexcept
+{
+    return detail::hash_mix(std::rotl(seed, 23) ^ (value + HASH_SEED));
+}
+
+template <class T>
+concept Hashable = std::is_default_constructible_v<std::hash<T>> && requires(const T& v) {
+    { std::hash<T>{}(v) } -> ConvertibleTo<std::size_t>;
+};
+
+// Elements whose object representation is their value can be hashed as raw bytes. Floating point numbers are excluded
+// because `0.0 == -0.0`.
+template <class T>
+inline constexpr bool is_bytewise_hashable_v =
+    (std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>) && std::has_unique_object_representations_v<T>;
+
+template <class... T>
+inline constexpr bool is_tuple_bytewise_hashable_v = (is_bytewise_hashable_v<std::remove_cvref_t<T>> && ... && true);
+
+template <class... T>
+inline constexpr std::size_t hash_word_count_v =
+    ((sizeof(std::remove_cvref_t<T>) + ... + std::size_t{}) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+// The elements are copied next to each other into zero-initialized words, so that a Tuple of values and a Tuple of
+// references to equal values produce the same words.
+template <class... T>
+auto hash_words(const ltpl::Tuple<T...>& tuple) noexcept
+{
+    std::array<std::uint64_t, hash_word_count_v<T...>> words{};
+    ltpl::apply(
+        [&](const auto&... v)
+        {
+            auto* bytes = reinterpret_cast<unsigned char*>(words.data());
+            ((std::memcpy(bytes, &v, sizeof(v)), bytes += sizeof(v)), ...);
+        },
+        tuple);
+    return words;
+}
+
+template <class... T>
+std::uint64_t hash_tuple(const ltpl::Tuple<T...>& tuple) noexcept
+{
+    std::uint64_t seed{};
+    if constexpr (is_tuple_bytewise_hashable_v<T...>)
+    {
+        for (const auto word : detail::hash_words(tuple))
+        {
+            seed = detail::hash_combine(seed, word);
+        }
+    }
+    else
+    {
+        ltpl::apply(
+            [&](const auto&... v)
+            {
+                ((seed = detail::hash_combine(seed, std::hash<std::remove_cvref_t<decltype(v)>>{}(v))), ...);
+            },
+            tuple);
+    }
+    return seed;
+}
+}  // namespace detail
+
+// Compute `std::hash<ltpl::Tuple<T...>>{}(keys[i])` for every key and store it in `hashes[i]`. `hashes` must have at
+// least as many elements as `keys`. Keys that are hashed as raw bytes are processed in groups whose hash computations
+// are independent of each other, which allows the compiler to interleave or vectorize them.
+template <class... T>
+void hash_batch(std::span<const ltpl::Tuple<T...>> keys, std::span<std::size_t> hashes) noexcept
+{
+    std::size_t i{};
+    if constexpr (detail::is_tuple_bytewise_hashable_v<T...>)
+    {
+        constexpr std::size_t LANES = 8;
+        constexpr std::size_t WORDS = detail::hash_word_count_v<T...>;
+        for (; i + LANES <= keys.size(); i += LANES)
+        {
+            std::array<std::array<std::uint64_t, WORDS>, LANES> words;
+            for (std::size_t lane{}; lane != LANES; ++lane)
+            {
+                words[lane] = detail::hash_words(keys[i + lane]);
+            }
+            std::array<std::uint64_t, LANES> seeds{};
+            for (std::size_t word{}; word != WORDS; ++word)
+            {
+                for (std::size_t lane{}; lane != LANES; ++lane)
+                {
+                    seeds[lane] = detail::hash_combine(seeds[lane], words[lane][word]);
+                }
+            }
+            for (std::size_t lane{}; lane != LANES; ++lane)
+            {
+                hashes[i + lane] = static_cast<std::size_t>(seeds[lane]);
+            }
+        }
+    }
+    for (; i != keys.size(); ++i)
+    {
+        hashes[i] = static_cast<std::size_t>(detail::hash_tuple(keys[i]));
+    }
+}
+}  // namespace ltpl
+
+// Combines the hashes of the elements with a strong mixing function. Tuples that consist only of integers, enums and
+// pointers are hashed as a sequence of bytes instead. A Tuple of references hashes like the corresponding Tuple of
+// values.
+template <class... T>
+requires(ltpl::detail::Hashable<std::remove_cvref_t<T>> && ... && true)
+struct std::hash<ltpl::Tuple<T...>>
+{
+    [[nodiscard]] std::size_t operator()(const ltpl::Tuple<T...>& tuple) const noexcept
+    {
+        return static_cast<std::size_t>(ltpl::detail::hash_tuple(tuple));
+    }
+};
+
+#endif  // LTPL_LTPL_HASH_HPP
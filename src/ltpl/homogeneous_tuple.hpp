@@ -0,0 +1,162 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_HOMOGENEOUS_TUPLE_HPP
+#define LTPL_LTPL_HOMOGENEOUS_TUPLE_HPP
+
+#include <ltpl/tuple.hpp>
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace ltpl
+{
+template <class T, std::size_t N>
+class HomogeneousTuple;
+
+namespace detail
+{
+struct HomogeneousAccess;
+
+template <class T, std::size_t>
+using AlwaysT = T;
+
+template <class T, class>
+struct RepeatTuple;
+
+template <class T, std::size_t... I>
+struct RepeatTuple<T, std::index_sequence<I...>>
+{
+    using Type = ltpl::Tuple<AlwaysT<T, I>...>;
+};
+
+// The Tuple type with N elements of type T.
+template <class T, std::size_t N>
+using RepeatTupleT = typename RepeatTuple<T, std::make_index_sequence<N>>::Type;
+
+struct HomogeneousAccess
+{
+    template <class T, std::size_t N>
+    static constexpr auto& elements(ltpl::HomogeneousTuple<T, N>& tuple) noexcept
+    {
+        return tuple.elements;
+    }
+
+    template <class T, std::size_t N>
+    static constexpr auto& elements(const ltpl::HomogeneousTuple<T, N>& tuple) noexcept
+    {
+        return tuple.elements;
+    }
+};
+}  // namespace detail
+
+// A Tuple of N elements of type T that are guaranteed to be stored contiguously, so that they can be processed with
+// ordinary loops through ltpl::as_span.
+template <class T, std::size_t N>
+class HomogeneousTuple
+{
+  public:
+    HomogeneousTuple() = default;
+
+    template <class... U>
+    constexpr explicit((!std::is_convertible_v<U, T> || ... || false))    //
+        HomogeneousTuple(U&&... v)                                        //
+        noexcept((std::is_nothrow_constructible_v<T, U> && ... && true))  //
+    requires(sizeof...(U) == N && N >= 1 && (std::is_constructible_v<T, U> && ... && true) &&
+             detail::is_not_exactly_v<HomogeneousTuple, U...>)
+        : elements{T(static_cast<U&&>(v))...}
+    {
+    }
+
+    template <class... U>
+    constexpr explicit HomogeneousTuple(const ltpl::Tuple<U...>& other)       //
+        noexcept((std::is_nothrow_constructible_v<T, const U&> && ... && true))  //
+    requires(sizeof...(U) == N && (std::is_constructible_v<T, const U&> && ... && true))
+        : elements(
+              [&]<std::size_t... I>(std::index_sequence<I...>)
+              {
+                  return std::array<T, N>{T(ltpl::get<I>(other))...};
+              }(std::make_index_sequence<N>{}))
+    {
+    }
+
+    [[nodiscard]] constexpr explicit operator detail::RepeatTupleT<T, N>() const
+    {
+        return [&]<std::size_t... I>(std::index_sequence<I...>)
+        {
+            return detail::RepeatTupleT<T, N>{elements[I]...};
+        }(std::make_index_sequence<N>{});
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(const HomogeneousTuple&, const HomogeneousTuple&) = default;
+
+    friend constexpr void swap(HomogeneousTuple& lhs, HomogeneousTuple& rhs)  //
+        noexcept(std::is_nothrow_swappable_v<T>)                             //
+    requires(std::is_swappable_v<T>)
+    {
+        lhs.elements.swap(rhs.elements);
+    }
+
+  private:
+    friend detail::HomogeneousAccess;
+
+    std::array<T, N> elements;
+};
+
+template <class T, class... U>
+HomogeneousTuple(T, U...) -> HomogeneousTuple<T, 1 + sizeof...(U)>;
+
+template <std::size_t I, class T, std::size_t N>
+[[nodiscard]] constexpr T& get(HomogeneousTuple<T, N>& tuple) noexcept
+{
+    return std::get<I>(detail::HomogeneousAccess::elements(tuple));
+}
+
+template <std::size_t I, class T, std::size_t N>
+[[nodiscard]] constexpr const T& get(const HomogeneousTuple<T, N>& tuple) noexcept
+{
+    return std::get<I>(detail::HomogeneousAccess::elements(tuple));
+}
+
+template <std::size_t I, class T, std::size_t N>
+[[nodiscard]] constexpr T&& get(HomogeneousTuple<T, N>&& tuple) noexcept
+{
+    return std::get<I>(std::move(detail::HomogeneousAccess::elements(tuple)));
+}
+
+template <std::size_t I, class T, std::size_t N>
+[[nodiscard]] constexpr const T&& get(const HomogeneousTuple<T, N>&& tuple) noexcept
+{
+    return std::get<I>(std::move(detail::HomogeneousAccess::elements(tuple)));
+}
+
+template <class T, std::size_t N>
+[[nodiscard]] constexpr std::span<T, N> as_span(HomogeneousTuple<T, N>& tuple) noexcept
+{
+    return std::span<T, N>{detail::HomogeneousAccess::elements(tuple)};
+}
+
+template <class T, std::size_t N>
+[[nodiscard]] constexpr std::span<const T, N> as_span(const HomogeneousTuple<T, N>& tuple) noexcept
+{
+    return std::span<const T, N>{detail::HomogeneousAccess::elements(tuple)};
+}
+}  // namespace ltpl
+
+template <class T, std::size_t N>
+struct std::tuple_size<ltpl::HomogeneousTuple<T, N>> : std::integral_constant<std::size_t, N>
+{
+};
+
+template <std::size_t I, class T, std::size_t N>
+struct std::tuple_element<I, ltpl::HomogeneousTuple<T, N>>
+{
+    using type = T;
+};
+
+#endif  // LTPL_LTPL_HOMOGENEOUS_TUPLE_HPP
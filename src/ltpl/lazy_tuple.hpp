@@ -0,0 +1,271 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_LAZY_TUPLE_HPP
+#define LTPL_LTPL_LAZY_TUPLE_HPP
+
+#include <ltpl/tuple.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ltpl
+{
+namespace detail
+{
+template <class F>
+using LazyResultT = std::remove_cvref_t<std::invoke_result_t<F&>>;
+
+// Uninitialized storage for one element. Whether `value` is alive is tracked by the owning LazyTuple.
+template <std::size_t I, class T>
+struct LazyValue
+{
+    LazyValue() noexcept {}
+
+    LazyValue(const LazyValue&) = delete;
+
+    LazyValue(LazyValue&&) = delete;
+
+    ~LazyValue() {}
+
+    LazyValue& operator=(const LazyValue&) = delete;
+
+    LazyValue& operator=(LazyValue&&) = delete;
+
+    union
+    {
+        T value;
+    };
+};
+
+template <class Sequence, class... T>
+struct LazyValues;
+
+template <std::size_t... I, class... T>
+struct LazyValues<std::index_sequence<I...>, T...> : LazyValue<I, T>...
+{
+};
+
+inline constexpr std::size_t LAZY_BITS_PER_WORD = 64;
+
+constexpr std::size_t lazy_word_count(std::size_t size) noexcept
+{
+    return (size + LAZY_BITS_PER_WORD - 1) / LAZY_BITS_PER_WORD;
+}
+
+constexpr std::uint64_t lazy_bit(std::size_t i) noexcept
+{
+    return std::uint64_t{1} << (i % LAZY_BITS_PER_WORD);
+}
+
+// Presence bitmask of the elements of a LazyTuple.
+template <std::size_t N, bool Synchronized>
+class LazyPresence
+{
+  public:
+    [[nodiscard]] bool test(std::size_t i) const noexcept
+    {
+        return (bits[i / LAZY_BITS_PER_WORD] & detail::lazy_bit(i)) != 0;
+    }
+
+    template <class F>
+    void initialize(std::size_t i, F&& f)
+    {
+        if (!test(i))
+        {
+            f();
+            bits[i / LAZY_BITS_PER_WORD] |= detail::lazy_bit(i);
+        }
+    }
+
+  private:
+    std::array<std::uint64_t, detail::lazy_word_count(N)> bits{};
+};
+
+// Once an element has been computed it is read with a single acquire load, std::call_once is only involved until then.
+template <std::size_t N>
+class LazyPresence<N, true>
+{
+  public:
+    [[nodiscard]] bool test(std::size_t i) const noexcept
+    {
+        return (bits[i / LAZY_BITS_PER_WORD].load(std::memory_order_acquire) & detail::lazy_bit(i)) != 0;
+    }
+
+    template <class F>
+    void initialize(std::size_t i, F&& f)
+    {
+        if (!test(i))
+        {
+            std::call_once(once[i],
+                           [&]
+                           {
+                               f();
+                               bits[i / LAZY_BITS_PER_WORD].fetch_or(detail::lazy_bit(i), std::memory_order_release);
+                           });
+        }
+    }
+
+  private:
+    std::array<std::atomic<std::uint64_t>, detail::lazy_word_count(N)> bits{};
+    std::array<std::once_flag, N> once;
+};
+
+struct LazyAccess
+{
+    template <std::size_t I, class Tuple>
+    static auto& element(const Tuple& tuple)
+    {
+        return tuple.template element<I>();
+    }
+};
+
+template <bool Synchronized, class... F>
+class LazyTupleBase
+{
+  public:
+    constexpr explicit LazyTupleBase(F... generators) : generators(static_cast<F&&>(generators)...) {}
+
+    LazyTupleBase(const LazyTupleBase&) = delete;
+
+    LazyTupleBase(LazyTupleBase&&) = delete;
+
+    ~LazyTupleBase()
+    {
+        [&]<std::size_t... I>(std::index_sequence<I...>)
+        {
+            (destroy<I>(), ...);
+        }(std::index_sequence_for<F...>{});
+    }
+
+    LazyTupleBase& operator=(const LazyTupleBase&) = delete;
+
+    LazyTupleBase& operator=(LazyTupleBase&&) = delete;
+
+    // Test whether the element at index I has already been computed.
+    template <std::size_t I>
+    [[nodiscard]] bool has_value() const noexcept
+    {
+        return presence.test(I);
+    }
+
+  private:
+    friend LazyAccess;
+
+    template <std::size_t I>
+    using ElementT = std::tuple_element_t<I, ltpl::Tuple<LazyResultT<F>...>>;
+
+    template <std::size_t I>
+    using Value = LazyValue<I, ElementT<I>>;
+
+    template <std::size_t I>
+    auto& element() const
+    {
+        auto& slot = static_cast<Value<I>&>(values);
+        presence.initialize(I,
+                            [&]
+                            {
+                                ::new (static_cast<void*>(std::addressof(slot.value)))
+                                    ElementT<I>(ltpl::get<I>(generators)());
+                            });
+        return slot.value;
+    }
+
+    template <std::size_t I>
+    void destroy() noexcept
+    {
+        if (presence.test(I))
+        {
+            std::destroy_at(std::addressof(static_cast<Value<I>&>(values).value));
+        }
+    }
+
+    // Computing an element does not change the observable state of the LazyTuple, therefore element access is const.
+    mutable ltpl::Tuple<F...> generators;
+    mutable LazyValues<std::index_sequence_for<F...>, LazyResultT<F>...> values;
+    mutable LazyPresence<sizeof...(F), Synchronized> presence;
+};
+}  // namespace detail
+
+// A Tuple whose elements are computed by invoking the corresponding generator on first access through ltpl::get. A
+// generator is invoked again on the next access only if it exited with an exception. Concurrent access is not allowed,
+// see ltpl::SynchronizedLazyTuple. Structured bindings access, and therefore compute, all elements.
+template <class... F>
+class LazyTuple : public detail::LazyTupleBase<false, F...>
+{
+  public:
+    using detail::LazyTupleBase<false, F...>::LazyTupleBase;
+};
+
+template <class... F>
+LazyTuple(F...) -> LazyTuple<F...>;
+
+// Like ltpl::LazyTuple but elements may be accessed concurrently. Every element is computed by exactly one thread while
+// other threads accessing it wait.
+template <class... F>
+class SynchronizedLazyTuple : public detail::LazyTupleBase<true, F...>
+{
+  public:
+    using detail::LazyTupleBase<true, F...>::LazyTupleBase;
+};
+
+template <class... F>
+SynchronizedLazyTuple(F...) -> SynchronizedLazyTuple<F...>;
+
+template <std::size_t I, bool Synchronized, class... F>
+[[nodiscard]] auto& get(detail::LazyTupleBase<Synchronized, F...>& tuple)
+{
+    return detail::LazyAccess::element<I>(tuple);
+}
+
+template <std::size_t I, bool Synchronized, class... F>
+[[nodiscard]] const auto& get(const detail::LazyTupleBase<Synchronized, F...>& tuple)
+{
+    return detail::LazyAccess::element<I>(tuple);
+}
+
+template <std::size_t I, bool Synchronized, class... F>
+[[nodiscard]] auto&& get(detail::LazyTupleBase<Synchronized, F...>&& tuple)
+{
+    return std::move(detail::LazyAccess::element<I>(tuple));
+}
+
+template <std::size_t I, bool Synchronized, class... F>
+[[nodiscard]] const auto&& get(const detail::LazyTupleBase<Synchronized, F...>&& tuple)
+{
+    return std::move(std::as_const(detail::LazyAccess::element<I>(tuple)));
+}
+}  // namespace ltpl
+
+template <class... F>
+struct std::tuple_size<ltpl::LazyTuple<F...>> : std::integral_constant<std::size_t, sizeof...(F)>
+{
+};
+
+template <std::size_t I, class... F>
+struct std::tuple_element<I, ltpl::LazyTuple<F...>>
+{
+    using type = std::tuple_element_t<I, ltpl::Tuple<ltpl::detail::LazyResultT<F>...>>;
+};
+
+template <class... F>
+struct std::tuple_size<ltpl::SynchronizedLazyTuple<F...>> : std::integral_constant<std::size_t, sizeof...(F)>
+{
+};
+
+template <std::size_t I, class... F>
+struct std::tuple_element<I, ltpl::SynchronizedLazyTuple<F...>>
+{
+    using type = std::tuple_element_t<I, ltpl::Tuple<ltpl::detail::LazyResultT<F>...>>;
+};
+
+#endif  // LTPL_LTPL_LAZY_TUPLE_HPP
@@ -0,0 +1,147 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_MAPPED_FILE_HPP
+#define LTPL_LTPL_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <utility>
+
+#if __has_include(<sys/mman.h>) && __has_include(<fcntl.h>) && __has_include(<unistd.h>)
+#define LTPL_MAPPED_FILE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ltpl
+{
+// Hint for the expected access pattern of a memory-mapped file, e.g. of a ltpl::MappedTupleTable, passed to `madvise`
+// where available.
+enum class TupleTableAccess
+{
+    NORMAL,
+    SEQUENTIAL,
+    RANDOM
+};
+
+namespace detail
+{
+// A read-only view of a whole file, memory-mapped where supported and read into memory otherwise.
+class MappedFile
+{
+  public:
+    MappedFile() = default;
+
+    MappedFile(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0))
+#ifndef LTPL_MAPPED_FILE_MMAP
+          ,
+          buffer(std::move(other.buffer))
+#endif
+    {
+    }
+
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile& operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+#ifndef LTPL_MAPPED_FILE_MMAP
+            buffer = std::move(other.buffer);
+#endif
+        }
+        return *this;
+    }
+
+    ~MappedFile() noexcept { unmap(); }
+
+    [[nodiscard]] bool open(const std::filesystem::path& path)
+    {
+#ifdef LTPL_MAPPED_FILE_MMAP
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1)
+        {
+            return false;
+        }
+        struct stat status{};
+        void* mapping = MAP_FAILED;
+        if (::fstat(fd, &status) == 0 && status.st_size > 0)
+        {
+            mapping = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+        ::close(fd);
+        if (mapping == MAP_FAILED)
+        {
+            return false;
+        }
+        unmap();
+        data_ = static_cast<const std::byte*>(mapping);
+        size_ = static_cast<std::size_t>(status.st_size);
+        return true;
+#else
+        std::ifstream file{path, std::ios::binary | std::ios::ate};
+        if (!file)
+        {
+            return false;
+        }
+        const auto size = static_cast<std::size_t>(file.tellg());
+        auto bytes = std::make_unique<std::byte[]>(size);
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char*>(bytes.get()), static_cast<std::streamsize>(size)))
+        {
+            return false;
+        }
+        buffer = std::move(bytes);
+        data_ = buffer.get();
+        size_ = size;
+        return true;
+#endif
+    }
+
+    void advise([[maybe_unused]] TupleTableAccess access) const noexcept
+    {
+#ifdef LTPL_MAPPED_FILE_MMAP
+        const int advice = access == TupleTableAccess::SEQUENTIAL ? MADV_SEQUENTIAL
+                           : access == TupleTableAccess::RANDOM   ? MADV_RANDOM
+                                                                  : MADV_NORMAL;
+        ::madvise(const_cast<std::byte*>(data_), size_, advice);
+#endif
+    }
+
+    [[nodiscard]] std::span<const std::byte> bytes() const noexcept { return {data_, size_}; }
+
+  private:
+    void unmap() noexcept
+    {
+#ifdef LTPL_MAPPED_FILE_MMAP
+        if (data_ != nullptr)
+        {
+            ::munmap(const_cast<std::byte*>(data_), size_);
+        }
+#endif
+    }
+
+    const std::byte* data_{};
+    std::size_t size_{};
+#ifndef LTPL_MAPPED_FILE_MMAP
+    std::unique_ptr<std::byte[]> buffer;
+#endif
+};
+}  // namespace detail
+}  // namespace ltpl
+
+#endif  // LTPL_LTPL_MAPPED_FILE_HPP
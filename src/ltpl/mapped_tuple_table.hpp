@@ -0,0 +1,210 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_MAPPED_TUPLE_TABLE_HPP
+#define LTPL_LTPL_MAPPED_TUPLE_TABLE_HPP
+
+#include <ltpl/hash.hpp>
+#include <ltpl/mapped_file.hpp>
+#include <ltpl/tuple.hpp>
+#include <ltpl/tuple_view.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ltpl
+{
+namespace detail
+{
+// "LTPLTBL1" in file order.
+inline constexpr std::array<char, 8> TUPLE_TABLE_MAGIC{'L', 'T', 'P', 'L', 'T', 'B', 'L', '1'};
+
+// Magic, type signature, row size and row count.
+inline constexpr std::size_t TUPLE_TABLE_HEADER_SIZE = TUPLE_TABLE_MAGIC.size() + 3 * sizeof(std::uint64_t);
+
+// Identifies the kind and size of an element, so that e.g. `int32_t` and `float` have different signatures.
+template <class T>
+constexpr std::uint64_t tuple_table_type_code() noexcept
+{
+    if constexpr (std::is_enum_v<T>)
+    {
+        return detail::tuple_table_type_code<std::underlying_type_t<T>>();
+    }
+    else
+    {
+        const std::uint64_t kind = std::is_same_v<T, bool>          ? 1
+                                   : std::is_floating_point_v<T> ? 2
+                                   : std::is_signed_v<T>         ? 3
+                                                                 : 4;
+        return kind << 8 | sizeof(T);
+    }
+}
+
+template <class... T>
+inline constexpr std::uint64_t TUPLE_TABLE_SIGNATURE = []
+{
+    std::uint64_t seed = detail::hash_combine(sizeof...(T), std::endian::native == std::endian::little ? 1 : 2);
+    ((seed = detail::hash_combine(seed, detail::tuple_table_type_code<T>())), ...);
+    return seed;
+}();
+
+inline std::uint64_t load_tuple_table_word(std::span<const std::byte> header, std::size_t index) noexcept
+{
+    std::uint64_t word;
+    std::memcpy(&word, header.data() + TUPLE_TABLE_MAGIC.size() + index * sizeof(word), sizeof(word));
+    return word;
+}
+}  // namespace detail
+
+// Write `rows` to a file that can be opened with ltpl::MappedTupleTable<T...>. The file consists of a header with a
+// signature of `T...` followed by the rows in the layout of ltpl::TupleView<T...>. Returns false on I/O errors.
+template <detail::TupleViewElement... T>
+[[nodiscard]] bool write_tuple_table(const std::filesystem::path& path, std::span<const ltpl::Tuple<T...>> rows)
+{
+    using View = ltpl::TupleView<T...>;
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    std::array<std::byte, detail::TUPLE_TABLE_HEADER_SIZE> header;
+    std::memcpy(header.data(), detail::TUPLE_TABLE_MAGIC.data(), detail::TUPLE_TABLE_MAGIC.size());
+    const std::array<std::uint64_t, 3> words{detail::TUPLE_TABLE_SIGNATURE<T...>, View::size_bytes, rows.size()};
+    std::memcpy(header.data() + detail::TUPLE_TABLE_MAGIC.size(), words.data(), sizeof(words));
+    file.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+    constexpr std::size_t CHUNK_ROWS = std::max(std::size_t{64 * 1024} / std::max(View::size_bytes, std::size_t{1}),
+                                                std::size_t{1});
+    std::vector<std::byte> chunk(CHUNK_ROWS * View::size_bytes);
+    for (std::size_t first{}; first < rows.size() && file; first += CHUNK_ROWS)
+    {
+        const auto count = std::min(rows.size() - first, CHUNK_ROWS);
+        for (std::size_t i{}; i != count; ++i)
+        {
+            View::write(rows[first + i], std::span{chunk}.subspan(i * View::size_bytes));
+        }
+        file.write(reinterpret_cast<const char*>(chunk.data()), static_cast<std::streamsize>(count * View::size_bytes));
+    }
+    file.close();
+    return static_cast<bool>(file);
+}
+
+// A read-only table of rows of `T...` backed by a file written by ltpl::write_tuple_table. The file is memory-mapped
+// where `mmap` is available, so that opening it costs a header check regardless of its size and rows are paged in on
+// first access. Rows are accessed through ltpl::TupleView<T...>.
+template <detail::TupleViewElement... T>
+class MappedTupleTable
+{
+  public:
+    using value_type = ltpl::TupleView<T...>;
+    using size_type = std::size_t;
+
+    class iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ltpl::TupleView<T...>;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type;
+
+        iterator() = default;
+
+        [[nodiscard]] value_type operator*() const noexcept { return value_type{{position, value_type::size_bytes}}; }
+
+        iterator& operator++() noexcept
+        {
+            position += value_type::size_bytes;
+            return *this;
+        }
+
+        iterator operator++(int) noexcept
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        [[nodiscard]] friend bool operator==(const iterator&, const iterator&) = default;
+
+      private:
+        friend MappedTupleTable;
+
+        explicit iterator(const std::byte* position) noexcept : position(position) {}
+
+        const std::byte* position{};
+    };
+
+    using const_iterator = iterator;
+
+    // Returns an empty optional if the file cannot be read, was not written for `T...` or is truncated.
+    [[nodiscard]] static std::optional<MappedTupleTable> open(const std::filesystem::path& path,
+                                                              TupleTableAccess access = TupleTableAccess::NORMAL)
+    {
+        detail::MappedFile file;
+        if (!file.open(path))
+        {
+            return std::nullopt;
+        }
+        const auto bytes = file.bytes();
+        if (bytes.size() < detail::TUPLE_TABLE_HEADER_SIZE ||
+            std::memcmp(bytes.data(), detail::TUPLE_TABLE_MAGIC.data(), detail::TUPLE_TABLE_MAGIC.size()) != 0 ||
+            detail::load_tuple_table_word(bytes, 0) != detail::TUPLE_TABLE_SIGNATURE<T...> ||
+            detail::load_tuple_table_word(bytes, 1) != value_type::size_bytes)
+        {
+            return std::nullopt;
+        }
+        const auto row_count = detail::load_tuple_table_word(bytes, 2);
+        const auto available = bytes.size() - detail::TUPLE_TABLE_HEADER_SIZE;
+        if (value_type::size_bytes == 0 ? row_count != 0 : row_count > available / value_type::size_bytes)
+        {
+            return std::nullopt;
+        }
+        if (access != TupleTableAccess::NORMAL)
+        {
+            file.advise(access);
+        }
+        return MappedTupleTable{std::move(file), static_cast<std::size_t>(row_count)};
+    }
+
+    [[nodiscard]] value_type operator[](std::size_t index) const noexcept
+    {
+        return value_type{{rows_data() + index * value_type::size_bytes, value_type::size_bytes}};
+    }
+
+    [[nodiscard]] iterator begin() const noexcept { return iterator{rows_data()}; }
+
+    [[nodiscard]] iterator end() const noexcept { return iterator{rows_data() + row_count * value_type::size_bytes}; }
+
+    [[nodiscard]] std::size_t size() const noexcept { return row_count; }
+
+    [[nodiscard]] bool empty() const noexcept { return row_count == 0; }
+
+    // Change the access pattern hint, e.g. to RANDOM after an initial sequential scan.
+    void advise(TupleTableAccess access) const noexcept { file.advise(access); }
+
+  private:
+    MappedTupleTable(detail::MappedFile&& file, std::size_t row_count) noexcept
+        : file(std::move(file)), row_count(row_count)
+    {
+    }
+
+    [[nodiscard]] const std::byte* rows_data() const noexcept
+    {
+        return file.bytes().data() + detail::TUPLE_TABLE_HEADER_SIZE;
+    }
+
+    detail::MappedFile file;
+    std::size_t row_count;
+};
+}  // namespace ltpl
+
+#endif  // LTPL_LTPL_MAPPED_TUPLE_TABLE_HPP
@@ -0,0 +1,293 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_MEMOIZE_HPP
+#define LTPL_LTPL_MEMOIZE_HPP
+
+#include <ltpl/flat_tuple_map.hpp>
+#include <ltpl/hash.hpp>
+#include <ltpl/tuple.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ltpl
+{
+namespace detail
+{
+template <class... Args>
+struct MemoizeArgs
+{
+};
+
+// The argument types of a function pointer or of a callable with a single, non-template call operator.
+template <class F>
+struct CallArgs
+{
+};
+
+template <class F>
+requires requires { &F::operator(); }
+struct CallArgs<F> : CallArgs<decltype(&F::operator())>
+{
+};
+
+template <class R, class... A>
+struct CallArgs<R (*)(A...)>
+{
+    using Type = MemoizeArgs<std::remove_cvref_t<A>...>;
+};
+
+template <class R, class... A>
+struct CallArgs<R (*)(A...) noexcept> : CallArgs<R (*)(A...)>
+{
+};
+
+template <class R, class C, class... A>
+struct CallArgs<R (C::*)(A...)> : CallArgs<R (*)(A...)>
+{
+};
+
+template <class R, class C, class... A>
+struct CallArgs<R (C::*)(A...) noexcept> : CallArgs<R (*)(A...)>
+{
+};
+
+template <class R, class C, class... A>
+struct CallArgs<R (C::*)(A...) const> : CallArgs<R (*)(A...)>
+{
+};
+
+template <class R, class C, class... A>
+struct CallArgs<R (C::*)(A...) const noexcept> : CallArgs<R (*)(A...)>
+{
+};
+
+// A fixed capacity cache that evicts with the CLOCK algorithm: a hit only sets a flag, a miss on a full cache advances
+// a hand over all entries, clearing flags, until it finds one whose flag is not set. Keys are stored in the entries as
+// well as in the index, so that the index can be updated on eviction.
+template <class Key, class R>
+class ClockCache
+{
+  public:
+    explicit ClockCache(std::size_t capacity) : capacity_(std::max(capacity, std::size_t{1}))
+    {
+        index.reserve(capacity_);
+        entries.reserve(capacity_);
+    }
+
+    template <class Tuple>
+    [[nodiscard]] const R* find(const Tuple& key)
+    {
+        const auto it = index.find(key);
+        if (it == index.end())
+        {
+            return nullptr;
+        }
+        auto& entry = entries[ltpl::get<1>(*it)];
+        entry.referenced = true;
+        return &entry.value;
+    }
+
+    // Insert unless another value has been inserted for the same key in the meantime.
+    template <class Tuple>
+    const R& insert(const Tuple& key, R&& value)
+    {
+        if (const auto* existing = find(key))
+        {
+            return *existing;
+        }
+        auto position = entries.size();
+        if (position < capacity_)
+        {
+            entries.push_back(Entry{Key(key), static_cast<R&&>(value), false});
+        }
+        else
+        {
+            position = evict();
+            auto& entry = entries[position];
+            entry.key = Key(key);
+            entry.value = static_cast<R&&>(value);
+            entry.referenced = false;
+        }
+        index.try_emplace(key, position);
+        return entries[position].value;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return entries.size(); }
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+  private:
+    struct Entry
+    {
+        Key key;
+        R value;
+        bool referenced;
+    };
+
+    std::size_t evict()
+    {
+        while (entries[hand].referenced)
+        {
+            entries[hand].referenced = false;
+            hand = (hand + 1) % capacity_;
+        }
+        const auto victim = hand;
+        hand = (hand + 1) % capacity_;
+        index.erase(entries[victim].key);
+        return victim;
+    }
+
+    ltpl::FlatTupleMap<Key, std::size_t> index;
+    std::vector<Entry> entries;
+    std::size_t hand{};
+    std::size_t capacity_;
+};
+
+template <class F, class... Args>
+using MemoizeResultT = std::remove_cvref_t<std::invoke_result_t<F&, const Args&...>>;
+
+template <class F, class Args>
+inline constexpr bool is_memoize_invocable_v = false;
+
+template <class F, class... A>
+inline constexpr bool is_memoize_invocable_v<F, MemoizeArgs<A...>> = std::is_invocable_v<F&, const A&...>;
+
+// The cached arguments are passed to `f` as const lvalues, so it must take them by value or by const reference. Without
+// explicit argument types they are deduced from `f`.
+template <class F, class... Args>
+concept MemoizeInvocable =
+    (sizeof...(Args) != 0 && std::is_invocable_v<F&, const std::remove_cvref_t<Args>&...>) ||
+    (sizeof...(Args) == 0 && is_memoize_invocable_v<F, typename CallArgs<std::remove_const_t<F>>::Type>);
+}  // namespace detail
+
+// A function wrapper that caches up to `capacity` results keyed by the arguments. Lookup uses a Tuple of references to
+// the arguments, which are only copied into the cache on a miss. Results are cached by value, even if `f` returns a
+// reference. Not safe for concurrent calls, see ltpl::ShardedMemoized.
+template <class F, class... Args>
+class Memoized
+{
+  public:
+    using key_type = ltpl::Tuple<Args...>;
+    using result_type = detail::MemoizeResultT<F, Args...>;
+
+    Memoized(F f, std::size_t capacity) : f(static_cast<F&&>(f)), cache(capacity) {}
+
+    result_type operator()(const Args&... args)
+    {
+        const ltpl::Tuple<const Args&...> key{args...};
+        if (const auto* value = cache.find(key))
+        {
+            return *value;
+        }
+        return cache.insert(key, result_type(f(args...)));
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return cache.size(); }
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return cache.capacity(); }
+
+  private:
+    F f;
+    detail::ClockCache<key_type, result_type> cache;
+};
+
+// Like ltpl::Memoized but safe for concurrent calls. The cache is split into independently locked shards selected by
+// the hash of the arguments. The function is invoked without holding a lock, so concurrent misses for the same
+// arguments may invoke it more than once.
+template <class F, class... Args>
+class ShardedMemoized
+{
+  public:
+    using key_type = ltpl::Tuple<Args...>;
+    using result_type = detail::MemoizeResultT<const F, Args...>;
+
+    ShardedMemoized(F f, std::size_t capacity, std::size_t shard_count)
+        : f(static_cast<F&&>(f)), shard_count(std::max(shard_count, std::size_t{1}))
+    {
+        const auto shard_capacity = (capacity + this->shard_count - 1) / this->shard_count;
+        shards = std::make_unique<std::unique_ptr<Shard>[]>(this->shard_count);
+        for (std::size_t i{}; i != this->shard_count; ++i)
+        {
+            shards[i] = std::make_unique<Shard>(shard_capacity);
+        }
+    }
+
+    result_type operator()(const Args&... args) const
+    {
+        const ltpl::Tuple<const Args&...> key{args...};
+        auto& shard = *shards[detail::hash_mix(std::hash<ltpl::Tuple<const Args&...>>{}(key)) % shard_count];
+        {
+            std::lock_guard lock{shard.mutex};
+            if (const auto* value = shard.cache.find(key))
+            {
+                return *value;
+            }
+        }
+        auto value = f(args...);
+        std::lock_guard lock{shard.mutex};
+        return shard.cache.insert(key, std::move(value));
+    }
+
+  private:
+    struct Shard
+    {
+        explicit Shard(std::size_t capacity) : cache(capacity) {}
+
+        std::mutex mutex;
+        detail::ClockCache<key_type, result_type> cache;
+    };
+
+    F f;
+    std::size_t shard_count;
+    std::unique_ptr<std::unique_ptr<Shard>[]> shards;
+};
+
+// Wrap `f` in a cache of up to `capacity` results, see ltpl::Memoized. The argument types are deduced from `f` unless
+// they are provided explicitly, e.g. `ltpl::memoize<int, std::string>(generic_lambda, 100)`.
+template <class... Args, class F>
+requires detail::MemoizeInvocable<F, Args...>
+[[nodiscard]] auto memoize(F f, std::size_t capacity)
+{
+    if constexpr (sizeof...(Args) == 0)
+    {
+        return [&]<class... A>(detail::MemoizeArgs<A...>)
+        {
+            return Memoized<F, A...>(static_cast<F&&>(f), capacity);
+        }(typename detail::CallArgs<F>::Type{});
+    }
+    else
+    {
+        return Memoized<F, std::remove_cvref_t<Args>...>(static_cast<F&&>(f), capacity);
+    }
+}
+
+// Wrap `f` in a cache of up to `capacity` results that is split into `shard_count` shards, see ltpl::ShardedMemoized.
+template <class... Args, class F>
+requires detail::MemoizeInvocable<const F, Args...>
+[[nodiscard]] auto memoize_sharded(F f, std::size_t capacity, std::size_t shard_count)
+{
+    if constexpr (sizeof...(Args) == 0)
+    {
+        return [&]<class... A>(detail::MemoizeArgs<A...>)
+        {
+            return ShardedMemoized<F, A...>(static_cast<F&&>(f), capacity, shard_count);
+        }(typename detail::CallArgs<F>::Type{});
+    }
+    else
+    {
+        return ShardedMemoized<F, std::remove_cvref_t<Args>...>(static_cast<F&&>(f), capacity, shard_count);
+    }
+}
+}  // namespace ltpl
+
+#endif  // LTPL_LTPL_MEMOIZE_HPP
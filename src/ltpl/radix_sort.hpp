@@ -0,0 +1,244 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_RADIX_SORT_HPP
+#define LTPL_LTPL_RADIX_SORT_HPP
+
+#include <ltpl/tuple.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ltpl
+{
+namespace detail
+{
+template <class T>
+inline constexpr bool is_key_encodable_v =
+    std::is_integral_v<T> || std::is_enum_v<T> ||
+    (std::is_floating_point_v<T> && std::numeric_limits<T>::is_iec559 &&
+     (sizeof(T) == sizeof(std::uint32_t) || sizeof(T) == sizeof(std::uint64_t))) ||
+    std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>;
+
+template <class... T>
+inline constexpr bool is_key_encodable_v<ltpl::Tuple<T...>> =
+    (is_key_encodable_v<std::remove_cvref_t<T>> && ... && true);
+
+template <class T>
+concept KeyEncodable = is_key_encodable_v<std::remove_cvref_t<T>>;
+
+// Big-endian, so that the most significant byte is compared first.
+template <class U>
+void encode_key_unsigned(U value, std::vector<unsigned char>& buffer)
+{
+    for (auto shift = static_cast<int>(sizeof(U) * CHAR_BIT); shift != 0;)
+    {
+        shift -= CHAR_BIT;
+        buffer.push_back(static_cast<unsigned char>(value >> shift));
+    }
+}
+
+template <class T>
+void encode_key_element(const T& value, std::vector<unsigned char>& buffer)
+{
+    if constexpr (IsTuple<T>)
+    {
+        ltpl::apply(
+            [&](const auto&... v)
+            {
+                (detail::encode_key_element(v, buffer), ...);
+            },
+            value);
+    }
+    else if constexpr (std::is_enum_v<T>)
+    {
+        detail::encode_key_element(static_cast<std::underlying_type_t<T>>(value), buffer);
+    }
+    else if constexpr (std::is_same_v<T, bool>)
+    {
+        buffer.push_back(value ? 1 : 0);
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        // Flipping the sign bit maps the signed range onto the unsigned range in order.
+        using U = std::make_unsigned_t<T>;
+        auto bits = static_cast<U>(value);
+        if constexpr (std::is_signed_v<T>)
+        {
+            bits ^= static_cast<U>(U{1} << (sizeof(U) * CHAR_BIT - 1));
+        }
+        detail::encode_key_unsigned(bits, buffer);
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        // Negative numbers have all bits flipped so that their magnitude orders in reverse, positive numbers only the
+        // sign bit so that they order after all negative numbers. `-0.0` is encoded like `0.0`.
+        using U = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+        constexpr U SIGN_BIT = U{1} << (sizeof(U) * CHAR_BIT - 1);
+        auto bits = value == T{} ? U{} : std::bit_cast<U>(value);
+        bits = (bits & SIGN_BIT) != 0 ? static_cast<U>(~bits) : static_cast<U>(bits | SIGN_BIT);
+        detail::encode_key_unsigned(bits, buffer);
+    }
+    else
+    {
+        // Zero bytes are escaped as `00 FF` and the string is terminated by `00 00`, which orders before any escaped or
+        // non-zero byte. The encoding is therefore prefix-free and a shorter string orders before its extensions.
+        for (const char c : std::string_view(value))
+        {
+            buffer.push_back(static_cast<unsigned char>(c));
+            if (c == '\0')
+            {
+                buffer.push_back(0xFF);
+            }
+        }
+        buffer.push_back(0);
+        buffer.push_back(0);
+    }
+}
+
+struct EncodedKeys
+{
+    [[nodiscard]] std::span<const unsigned char> key(std::size_t i) const noexcept
+    {
+        return {bytes.data() + offsets[i], offsets[i + 1] - offsets[i]};
+    }
+
+    std::vector<unsigned char> bytes;
+    std::vector<std::size_t> offsets;
+};
+
+inline constexpr std::size_t RADIX_SORT_INSERTION_THRESHOLD = 32;
+
+struct RadixSortRange
+{
+    std::size_t* first;
+    std::size_t* last;
+    std::size_t depth;
+};
+
+// Stable most-significant-byte radix sort of the key indices in [first, last). Keys that end at the current depth go
+// into the first bucket, all others into the bucket of their next byte. Buckets that remain to be sorted are kept on an
+// explicit stack instead of recursing, since keys with a long common prefix would otherwise nest one call per shared
+// byte. A range whose keys all share the next byte only advances its depth.
+inline void radix_sort_indices(const EncodedKeys& keys, std::size_t* first, std::size_t* last, std::size_t* scratch)
+{
+    std::vector<RadixSortRange> ranges{{first, last, 0}};
+    while (!ranges.empty())
+    {
+        const auto range = ranges.back();
+        ranges.pop_back();
+        const auto depth = range.depth;
+        const auto count = static_cast<std::size_t>(range.last - range.first);
+        if (count <= RADIX_SORT_INSERTION_THRESHOLD)
+        {
+            std::stable_sort(range.first, range.last,
+                             [&](std::size_t lhs, std::size_t rhs)
+                             {
+                                 const auto l = keys.key(lhs).subspan(depth);
+                                 const auto r = keys.key(rhs).subspan(depth);
+                                 return std::lexicographical_compare(l.begin(), l.end(), r.begin(), r.end());
+                             });
+            continue;
+        }
+        const auto bucket_of = [&](std::size_t index)
+        {
+            const auto key = keys.key(index);
+            return key.size() == depth ? std::size_t{} : std::size_t{key[depth]} + 1;
+        };
+        std::array<std::size_t, 258> offsets{};
+        for (auto* it = range.first; it != range.last; ++it)
+        {
+            ++offsets[bucket_of(*it) + 1];
+        }
+        if (offsets[1] == count)
+        {
+            continue;
+        }
+        if (offsets[bucket_of(*range.first) + 1] == count)
+        {
+            ranges.push_back({range.first, range.last, depth + 1});
+            continue;
+        }
+        for (std::size_t bucket{}; bucket != 257; ++bucket)
+        {
+            offsets[bucket + 1] += offsets[bucket];
+        }
+        auto position = offsets;
+        for (auto* it = range.first; it != range.last; ++it)
+        {
+            scratch[position[bucket_of(*it)]++] = *it;
+        }
+        std::copy_n(scratch, count, range.first);
+        for (std::size_t bucket = 1; bucket != 257; ++bucket)
+        {
+            if (offsets[bucket + 1] - offsets[bucket] > 1)
+            {
+                ranges.push_back({range.first + offsets[bucket], range.first + offsets[bucket + 1], depth + 1});
+            }
+        }
+    }
+}
+}  // namespace detail
+
+// Append a byte string to `buffer` that orders like the Tuple under `operator<=>` when compared with `std::memcmp` (or
+// `std::lexicographical_compare`) against the encoding of another Tuple of the same types. Supported elements are
+// integers, enums, `float`, `double`, `std::string`, `std::string_view` and nested Tuples thereof. The order of NaNs,
+// which `operator<=>` considers unordered, is unspecified.
+template <class... T>
+requires(detail::KeyEncodable<T> && ... && true)
+void encode_key(const ltpl::Tuple<T...>& tuple, std::vector<unsigned char>& buffer)
+{
+    detail::encode_key_element(tuple, buffer);
+}
+
+// Stable sort of the rows in the order of `operator<=>`. The keys of all rows are encoded with ltpl::encode_key once
+// and sorted byte-wise, followed by a single pass that moves each row into place.
+template <class... T>
+requires(detail::KeyEncodable<T> && ... && true) &&
+        (std::is_move_constructible_v<ltpl::Tuple<T...>> && std::is_move_assignable_v<ltpl::Tuple<T...>>)
+void radix_sort(std::span<ltpl::Tuple<T...>> rows)
+{
+    const auto size = rows.size();
+    if (size < 2)
+    {
+        return;
+    }
+    detail::EncodedKeys keys;
+    keys.offsets.reserve(size + 1);
+    keys.offsets.push_back(0);
+    for (const auto& row : rows)
+    {
+        ltpl::encode_key(row, keys.bytes);
+        keys.offsets.push_back(keys.bytes.size());
+    }
+    std::vector<std::size_t> indices(size);
+    for (std::size_t i{}; i != size; ++i)
+    {
+        indices[i] = i;
+    }
+    std::vector<std::size_t> scratch(size);
+    detail::radix_sort_indices(keys, indices.data(), indices.data() + size, scratch.data());
+    std::vector<ltpl::Tuple<T...>> sorted;
+    sorted.reserve(size);
+    for (const auto index : indices)
+    {
+        sorted.push_back(std::move(rows[index]));
+    }
+    std::move(sorted.begin(), sorted.end(), rows.begin());
+}
+}  // namespace ltpl
+
+#endif  // LTPL_LTPL_RADIX_SORT_HPP
@@ -0,0 +1,545 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_RECORD_LOG_HPP
+#define LTPL_LTPL_RECORD_LOG_HPP
+
+#include <ltpl/mapped_file.hpp>
+#include <ltpl/serialize.hpp>
+#include <ltpl/tuple.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if __has_include(<fcntl.h>) && __has_include(<unistd.h>)
+#define LTPL_RECORD_LOG_POSIX
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#include <cstdio>
+#ifdef _MSC_VER
+#include <io.h>
+#endif
+#endif
+
+namespace ltpl
+{
+struct RecordLogOptions
+{
+    // The size of each of the two buffers, which bounds the size of a batch and of a single record.
+    std::size_t buffer_size{1024 * 1024};
+};
+
+namespace detail
+{
+inline constexpr auto CRC32C_TABLE = []
+{
+    std::array<std::uint32_t, 256> table{};
+    for (std::uint32_t i{}; i != table.size(); ++i)
+    {
+        auto crc = i;
+        for (int bit{}; bit != 8; ++bit)
+        {
+            crc = (crc & 1) != 0 ? (crc >> 1) ^ 0x82F63B78 : crc >> 1;
+        }
+        table[i] = crc;
+    }
+    return table;
+}();
+
+// CRC-32C (Castagnoli), continuing from `crc`.
+inline std::uint32_t crc32c(std::span<const std::byte> bytes, std::uint32_t crc = 0) noexcept
+{
+    crc = ~crc;
+    for (const auto byte : bytes)
+    {
+        crc = CRC32C_TABLE[(crc ^ static_cast<std::uint8_t>(byte)) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+// Every record is framed by its payload size and a CRC-32C of the size and the payload, both 32-bit native byte order.
+inline constexpr std::size_t RECORD_LOG_HEADER_SIZE = 2 * sizeof(std::uint32_t);
+
+inline std::uint32_t record_log_checksum(const std::byte* frame, std::size_t payload_size) noexcept
+{
+    const auto crc = detail::crc32c({frame, sizeof(std::uint32_t)});
+    return detail::crc32c({frame + RECORD_LOG_HEADER_SIZE, payload_size}, crc);
+}
+
+// The payload of the frame at the start of `bytes`, or an empty optional if it is truncated or corrupt.
+inline std::optional<std::span<const std::byte>> record_log_payload(std::span<const std::byte> bytes) noexcept
+{
+    if (bytes.size() < RECORD_LOG_HEADER_SIZE)
+    {
+        return std::nullopt;
+    }
+    std::array<std::uint32_t, 2> header;
+    std::memcpy(header.data(), bytes.data(), RECORD_LOG_HEADER_SIZE);
+    if (header[0] > bytes.size() - RECORD_LOG_HEADER_SIZE ||
+        header[1] != detail::record_log_checksum(bytes.data(), header[0]))
+    {
+        return std::nullopt;
+    }
+    return bytes.subspan(RECORD_LOG_HEADER_SIZE, header[0]);
+}
+
+// The size of the longest prefix of `bytes` that consists of intact frames.
+inline std::size_t record_log_valid_size(std::span<const std::byte> bytes) noexcept
+{
+    std::size_t size{};
+    while (const auto payload = detail::record_log_payload(bytes.subspan(size)))
+    {
+        size += RECORD_LOG_HEADER_SIZE + payload->size();
+    }
+    return size;
+}
+
+class RecordLogFile
+{
+  public:
+    RecordLogFile() = default;
+
+    RecordLogFile(const RecordLogFile&) = delete;
+    RecordLogFile& operator=(const RecordLogFile&) = delete;
+
+    ~RecordLogFile() noexcept
+    {
+#ifdef LTPL_RECORD_LOG_POSIX
+        if (fd != -1)
+        {
+            ::close(fd);
+        }
+#else
+        if (file != nullptr)
+        {
+            std::fclose(file);
+        }
+#endif
+    }
+
+    [[nodiscard]] bool open(const std::filesystem::path& path)
+    {
+#ifdef LTPL_RECORD_LOG_POSIX
+        fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+        return fd != -1;
+#elif defined(_MSC_VER)
+        return ::_wfopen_s(&file, path.c_str(), L"ab") == 0;
+#else
+        file = std::fopen(path.string().c_str(), "ab");
+        return file != nullptr;
+#endif
+    }
+
+    [[nodiscard]] bool write(const std::byte* data, std::size_t size) noexcept
+    {
+#ifdef LTPL_RECORD_LOG_POSIX
+        while (size != 0)
+        {
+            const auto written = ::write(fd, data, size);
+            if (written == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return false;
+            }
+            data += written;
+            size -= static_cast<std::size_t>(written);
+        }
+        return true;
+#else
+        return std::fwrite(data, 1, size, file) == size;
+#endif
+    }
+
+    // Make the written data durable. Only the data is synchronized where `fdatasync` is available. On Windows `_commit`
+    // flushes the file through `FlushFileBuffers`. On other platforms the data is only handed to the operating system.
+    [[nodiscard]] bool sync() noexcept
+    {
+#if defined(LTPL_RECORD_LOG_POSIX) && defined(_POSIX_SYNCHRONIZED_IO) && _POSIX_SYNCHRONIZED_IO > 0 && \
+    !defined(__APPLE__)
+        return ::fdatasync(fd) == 0;
+#elif defined(LTPL_RECORD_LOG_POSIX)
+        return ::fsync(fd) == 0;
+#elif defined(_MSC_VER)
+        return std::fflush(file) == 0 && ::_commit(::_fileno(file)) == 0;
+#else
+        return std::fflush(file) == 0;
+#endif
+    }
+
+  private:
+#ifdef LTPL_RECORD_LOG_POSIX
+    int fd{-1};
+#else
+    std::FILE* file{};
+#endif
+};
+
+// The type-independent part of ltpl::RecordLog. Appenders reserve space in the active one of two buffers with a single
+// atomic add on `state`, which holds the generation of the active buffer in its upper bits and the number of reserved
+// bytes in its lower bits. The flusher thread seals the active buffer by starting the next generation, waits for the
+// appenders of the sealed buffer to finish copying and writes it with one `write` and one `fdatasync`, while appenders
+// continue in the other buffer.
+class RecordLogCore
+{
+  public:
+    explicit RecordLogCore(std::size_t buffer_size)
+        : capacity(std::min(buffer_size, std::size_t{std::numeric_limits<std::uint32_t>::max()})),
+          buffers{Buffer{std::make_unique<std::byte[]>(capacity)}, Buffer{std::make_unique<std::byte[]>(capacity)}}
+    {
+    }
+
+    RecordLogCore(const RecordLogCore&) = delete;
+    RecordLogCore& operator=(const RecordLogCore&) = delete;
+
+    ~RecordLogCore() noexcept
+    {
+        if (flusher.joinable())
+        {
+            {
+                std::lock_guard lock{mutex};
+                stopping = true;
+            }
+            wakeup.notify_one();
+            flusher.join();
+        }
+    }
+
+    // Open or create the log, cutting off a torn or corrupt tail left by a crash so that new records follow the last
+    // intact one.
+    [[nodiscard]] bool open(const std::filesystem::path& path)
+    {
+        std::error_code error;
+        const auto size = std::filesystem::file_size(path, error);
+        if (!error && size != 0)
+        {
+            detail::MappedFile existing;
+            if (!existing.open(path))
+            {
+                return false;
+            }
+            const auto valid_size = detail::record_log_valid_size(existing.bytes());
+            existing = {};
+            if (valid_size != size)
+            {
+                std::filesystem::resize_file(path, valid_size, error);
+                if (error)
+                {
+                    return false;
+                }
+            }
+        }
+        if (!file.open(path))
+        {
+            return false;
+        }
+        flusher = std::thread{&RecordLogCore::run, this};
+        return true;
+    }
+
+    // Reserve a frame for a payload of `payload_size` bytes and let `fill` write the payload into it.
+    template <class F>
+    [[nodiscard]] bool append(std::size_t payload_size, F&& fill)
+    {
+        if (capacity < RECORD_LOG_HEADER_SIZE || payload_size > capacity - RECORD_LOG_HEADER_SIZE)
+        {
+            return false;
+        }
+        const auto frame_size = RECORD_LOG_HEADER_SIZE + payload_size;
+        for (;;)
+        {
+            if (failed.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+            const auto reserved = state.fetch_add(frame_size, std::memory_order_acq_rel);
+            const auto generation = reserved >> OFFSET_BITS;
+            const auto offset = reserved & OFFSET_MASK;
+            auto& buffer = buffers[generation % 2];
+            if (offset + frame_size <= capacity)
+            {
+                auto* frame = buffer.data.get() + offset;
+                fill(frame + RECORD_LOG_HEADER_SIZE);
+                const std::array<std::uint32_t, 2> header{static_cast<std::uint32_t>(payload_size), 0};
+                std::memcpy(frame, header.data(), sizeof(std::uint32_t));
+                const auto checksum = detail::record_log_checksum(frame, payload_size);
+                std::memcpy(frame + sizeof(std::uint32_t), &checksum, sizeof(checksum));
+                buffer.written.fetch_add(frame_size, std::memory_order_relaxed);
+                buffer.done.fetch_add(frame_size, std::memory_order_release);
+                if (offset == 0)
+                {
+                    {
+                        std::lock_guard lock{mutex};
+                    }
+                    wakeup.notify_one();
+                }
+                return true;
+            }
+            // The buffer is full, retry in the next generation.
+            buffer.done.fetch_add(frame_size, std::memory_order_release);
+            std::unique_lock lock{mutex};
+            changed.wait(lock,
+                         [&]
+                         {
+                             return (state.load(std::memory_order_acquire) >> OFFSET_BITS) != generation ||
+                                    failed.load(std::memory_order_relaxed);
+                         });
+        }
+    }
+
+    // Wait until all records that have been appended before are synchronized, see RecordLogFile::sync.
+    [[nodiscard]] bool sync()
+    {
+        std::unique_lock lock{mutex};
+        const auto target = sealed + ((state.load(std::memory_order_acquire) & OFFSET_MASK) != 0 ? 1 : 0);
+        changed.wait(lock, [&] { return flushed >= target || failed.load(std::memory_order_relaxed); });
+        return !failed.load(std::memory_order_relaxed);
+    }
+
+  private:
+    static constexpr unsigned OFFSET_BITS = 40;
+    static constexpr std::uint64_t OFFSET_MASK = (std::uint64_t{1} << OFFSET_BITS) - 1;
+
+    struct Buffer
+    {
+        explicit Buffer(std::unique_ptr<std::byte[]> data) noexcept : data(std::move(data)) {}
+
+        std::unique_ptr<std::byte[]> data;
+
+        // Bytes of the frames that have been copied into the buffer.
+        std::atomic<std::size_t> written{};
+
+        // Bytes of all reservations that have completed, including those that did not fit.
+        std::atomic<std::size_t> done{};
+    };
+
+    void run()
+    {
+        for (;;)
+        {
+            {
+                std::unique_lock lock{mutex};
+                wakeup.wait(lock,
+                            [&] { return (state.load(std::memory_order_acquire) & OFFSET_MASK) != 0 || stopping; });
+                if ((state.load(std::memory_order_acquire) & OFFSET_MASK) == 0)
+                {
+                    return;
+                }
+            }
+            flush();
+        }
+    }
+
+    void flush()
+    {
+        std::uint64_t generation;
+        std::uint64_t reserved;
+        {
+            std::lock_guard lock{mutex};
+            generation = state.load(std::memory_order_relaxed) >> OFFSET_BITS;
+            reserved = state.exchange((generation + 1) << OFFSET_BITS, std::memory_order_acq_rel) & OFFSET_MASK;
+            ++sealed;
+        }
+        changed.notify_all();
+        auto& buffer = buffers[generation % 2];
+        while (buffer.done.load(std::memory_order_acquire) != reserved)
+        {
+            std::this_thread::yield();
+        }
+        const auto size = buffer.written.load(std::memory_order_relaxed);
+        buffer.written.store(0, std::memory_order_relaxed);
+        buffer.done.store(0, std::memory_order_relaxed);
+        const bool written =
+            !failed.load(std::memory_order_relaxed) && file.write(buffer.data.get(), size) && file.sync();
+        {
+            std::lock_guard lock{mutex};
+            if (!written)
+            {
+                failed.store(true, std::memory_order_relaxed);
+            }
+            ++flushed;
+        }
+        changed.notify_all();
+    }
+
+    std::size_t capacity;
+    std::array<Buffer, 2> buffers;
+    std::atomic<std::uint64_t> state{};
+    std::atomic<bool> failed{};
+    RecordLogFile file;
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    std::condition_variable changed;
+    std::uint64_t sealed{};
+    std::uint64_t flushed{};
+    bool stopping{};
+    std::thread flusher;
+};
+}  // namespace detail
+
+// An append-only log of Tuples in a file, e.g. for persisting events. Records are serialized as by ltpl::serialize and
+// framed by their size and a CRC-32C. Appending claims space in an in-memory buffer without taking a lock, a background
+// thread writes the buffered records in batches with one `write` and one `fdatasync` per batch (group commit). Once
+// ltpl::RecordLog::sync returns true, all records appended before the call are durable on POSIX systems and Windows.
+// Elsewhere they have only been handed to the operating system. Read the log with ltpl::RecordLogReader.
+template <class... T>
+requires detail::is_serializable_v<ltpl::Tuple<T...>>
+class RecordLog
+{
+  public:
+    // Opens or creates the log at `path`. An incomplete or corrupt tail, e.g. from a crash during a write, is removed.
+    // Returns an empty optional if the file cannot be opened.
+    [[nodiscard]] static std::optional<RecordLog> open(const std::filesystem::path& path, RecordLogOptions options = {})
+    {
+        auto core = std::make_unique<detail::RecordLogCore>(options.buffer_size);
+        if (!core->open(path))
+        {
+            return std::nullopt;
+        }
+        return RecordLog{std::move(core)};
+    }
+
+    // Thread-safe. Returns false if the record does not fit into a buffer or a previous write failed. Blocks only when
+    // both buffers are full.
+    [[nodiscard]] bool append(const ltpl::Tuple<T...>& record)
+    {
+        constexpr auto ROW_SIZE = detail::trivial_row_size_v<ltpl::Tuple<T...>>;
+        if constexpr (ROW_SIZE != 0)
+        {
+            return core->append(ROW_SIZE,
+                                [&](std::byte* payload)
+                                {
+                                    detail::ChunkByteSink sink{payload};
+                                    ltpl::serialize(record, sink);
+                                });
+        }
+        else
+        {
+            thread_local std::vector<std::byte> scratch;
+            scratch.clear();
+            VectorByteSink sink{scratch};
+            ltpl::serialize(record, sink);
+            return core->append(scratch.size(),
+                                [&](std::byte* payload) { std::memcpy(payload, scratch.data(), scratch.size()); });
+        }
+    }
+
+    // Thread-safe. Blocks until all records appended before the call have been written and synchronized, concurrent
+    // callers share the same `fdatasync`. Returns false if a write failed.
+    [[nodiscard]] bool sync() { return core->sync(); }
+
+  private:
+    explicit RecordLog(std::unique_ptr<detail::RecordLogCore> core) noexcept : core(std::move(core)) {}
+
+    std::unique_ptr<detail::RecordLogCore> core;
+};
+
+// Reads the records of a file written by ltpl::RecordLog<T...> for recovery. Iteration stops at the first record that
+// is incomplete or fails its checksum.
+template <class... T>
+requires detail::is_deserializable_v<ltpl::Tuple<T...>>
+class RecordLogReader
+{
+  public:
+    class iterator
+    {
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = ltpl::Tuple<T...>;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        [[nodiscard]] const value_type& operator*() const noexcept { return record; }
+
+        [[nodiscard]] const value_type* operator->() const noexcept { return &record; }
+
+        iterator& operator++()
+        {
+            next();
+            return *this;
+        }
+
+        void operator++(int) { next(); }
+
+        [[nodiscard]] friend bool operator==(const iterator& it, std::default_sentinel_t) noexcept { return it.at_end; }
+
+      private:
+        friend RecordLogReader;
+
+        explicit iterator(std::span<const std::byte> bytes) : bytes(bytes) { next(); }
+
+        void next()
+        {
+            const auto payload = detail::record_log_payload(bytes);
+            if (!payload)
+            {
+                at_end = true;
+                return;
+            }
+            SpanByteSource source{*payload};
+            auto decoded = ltpl::deserialize<value_type>(source);
+            if (!decoded || !source.remaining().empty())
+            {
+                at_end = true;
+                return;
+            }
+            record = std::move(*decoded);
+            bytes = bytes.subspan(detail::RECORD_LOG_HEADER_SIZE + payload->size());
+            at_end = false;
+        }
+
+        std::span<const std::byte> bytes;
+        value_type record;
+        bool at_end{true};
+    };
+
+    // Returns an empty optional if the file cannot be read.
+    [[nodiscard]] static std::optional<RecordLogReader> open(const std::filesystem::path& path)
+    {
+        std::error_code error;
+        const auto size = std::filesystem::file_size(path, error);
+        detail::MappedFile file;
+        if (error || (size != 0 && !file.open(path)))
+        {
+            return std::nullopt;
+        }
+        return RecordLogReader{std::move(file)};
+    }
+
+    [[nodiscard]] iterator begin() const { return iterator{file.bytes()}; }
+
+    [[nodiscard]] std::default_sentinel_t end() const noexcept { return {}; }
+
+    // The number of bytes up to the end of the last intact record.
+    [[nodiscard]] std::size_t valid_size() const noexcept { return detail::record_log_valid_size(file.bytes()); }
+
+  private:
+    explicit RecordLogReader(detail::MappedFile&& file) noexcept : file(std::move(file)) {}
+
+    detail::MappedFile file;
+};
+}  // namespace ltpl
+
+#endif  // LTPL_LTPL_RECORD_LOG_HPP
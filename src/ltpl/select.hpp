@@ -0,0 +1,125 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_SELECT_HPP
+#define LTPL_LTPL_SELECT_HPP
+
+#include <ltpl/tuple.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ltpl
+{
+namespace detail
+{
+template <class Tuple>
+inline constexpr std::size_t tuple_size_of_v = std::tuple_size<std::remove_cvref_t<Tuple>>::value;
+
+// The type returned by ltpl::get<I> for the given value category of the Tuple.
+template <std::size_t I, class Tuple>
+using GetT = decltype(ltpl::get<I>(std::declval<Tuple>()));
+
+template <class T, class Tuple>
+constexpr std::size_t index_of() noexcept
+{
+    return [&]<std::size_t... I>(std::index_sequence<I...>)
+    {
+        std::size_t index{};
+        (void((std::is_same_v<T, std::tuple_element_t<I, std::remove_cvref_t<Tuple>>> && (index = I, true))), ...);
+        return index;
+    }(std::make_index_sequence<tuple_size_of_v<Tuple>>{});
+}
+
+template <class T, class Tuple>
+constexpr std::size_t count_of() noexcept
+{
+    return [&]<std::size_t... I>(std::index_sequence<I...>)
+    {
+        return (std::size_t{} + ... +
+                std::size_t{std::is_same_v<T, std::tuple_element_t<I, std::remove_cvref_t<Tuple>>>});
+    }(std::make_index_sequence<tuple_size_of_v<Tuple>>{});
+}
+
+// Unpack the storage lambda once and wrap references to the selected elements into a new Tuple.
+template <std::size_t... I, class Tuple>
+constexpr ltpl::Tuple<GetT<I, Tuple>...> select(Tuple&& tuple) noexcept
+{
+    return Access::lambda(const_cast<std::remove_cvref_t<Tuple>&>(tuple))(
+        [](auto&... v)
+        {
+            return ltpl::Tuple<GetT<I, Tuple>...>(static_cast<GetT<I, Tuple>>(detail::get_nth<I>(v...))...);
+        });
+}
+
+template <std::size_t... I>
+constexpr bool are_unique() noexcept
+{
+    constexpr std::array<std::size_t, sizeof...(I)> indices{I...};
+    for (std::size_t i{}; i < indices.size(); ++i)
+    {
+        for (std::size_t j{}; j != i; ++j)
+        {
+            if (indices[i] == indices[j])
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <std::size_t Size, std::size_t... Dropped>
+inline constexpr auto kept_indices = []
+{
+    std::array<std::size_t, Size - sizeof...(Dropped)> array{};
+    std::size_t i{};
+    for (std::size_t index{}; index != Size; ++index)
+    {
+        if ((true && ... && (index != Dropped)))
+        {
+            array[i] = index;
+            ++i;
+        }
+    }
+    return array;
+}();
+}  // namespace detail
+
+// Obtain a Tuple of references to the elements at indices I... without copying them. The references are lvalue
+// references for lvalue Tuples, const lvalue references for const Tuples and rvalue references for rvalue Tuples,
+// matching the result of ltpl::get<I>.
+template <std::size_t... I, detail::IsTuple Tuple>
+requires((I < detail::tuple_size_of_v<Tuple>) && ... && true)
+[[nodiscard]] constexpr ltpl::Tuple<detail::GetT<I, Tuple>...> select(Tuple&& tuple) noexcept
+{
+    return detail::select<I...>(static_cast<Tuple&&>(tuple));
+}
+
+// Obtain a Tuple of references to the elements of types T... without copying them. Each type must occur exactly once in
+// the Tuple.
+template <class... T, detail::IsTuple Tuple>
+requires(sizeof...(T) > 0 && ((detail::count_of<T, Tuple>() == 1) && ... && true))
+[[nodiscard]] constexpr ltpl::Tuple<detail::GetT<detail::index_of<T, Tuple>(), Tuple>...> select(Tuple&& tuple) noexcept
+{
+    return detail::select<detail::index_of<T, Tuple>()...>(static_cast<Tuple&&>(tuple));
+}
+
+// Obtain a Tuple of references to all elements except those at indices I..., which must be unique.
+template <std::size_t... I, detail::IsTuple Tuple>
+requires((I < detail::tuple_size_of_v<Tuple>) && ... && true) && (detail::are_unique<I...>())
+[[nodiscard]] constexpr auto drop(Tuple&& tuple) noexcept
+{
+    constexpr auto& indices = detail::kept_indices<detail::tuple_size_of_v<Tuple>, I...>;
+    return [&]<std::size_t... J>(std::index_sequence<J...>)
+    {
+        return detail::select<indices[J]...>(static_cast<Tuple&&>(tuple));
+    }(std::make_index_sequence<indices.size()>{});
+}
+}  // namespace ltpl
+
+#endif  // LTPL_LTPL_SELECT_HPP
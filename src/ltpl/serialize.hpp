@@ -0,0 +1,509 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_SERIALIZE_HPP
+#define LTPL_LTPL_SERIALIZE_HPP
+
+#include <ltpl/tuple.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ltpl
+{
+// A byte sink that appends to a vector. Any type with a member function `write(const std::byte*, std::size_t)` can be
+// used as a byte sink.
+class VectorByteSink
+{
+  public:
+    explicit VectorByteSink(std::vector<std::byte>& bytes) noexcept : bytes(&bytes) {}
+
+    void write(const std::byte* data, std::size_t size) { bytes->insert(bytes->end(), data, data + size); }
+
+  private:
+    std::vector<std::byte>* bytes;
+};
+
+// A byte source that reads from a span. Any type with a member function `read(std::byte*, std::size_t)` that returns
+// false when fewer bytes are available can be used as a byte source.
+class SpanByteSource
+{
+  public:
+    explicit SpanByteSource(std::span<const std::byte> bytes) noexcept : bytes(bytes) {}
+
+    [[nodiscard]] bool read(std::byte* data, std::size_t size) noexcept
+    {
+        if (size > bytes.size())
+        {
+            return false;
+        }
+        if (size != 0)
+        {
+            std::memcpy(data, bytes.data(), size);
+        }
+        bytes = bytes.subspan(size);
+        return true;
+    }
+
+    [[nodiscard]] std::span<const std::byte> remaining() const noexcept { return bytes; }
+
+  private:
+    std::span<const std::byte> bytes;
+};
+
+// Opt-in for trivially copyable class types whose bytes remain meaningful in another process, i.e. that hold no
+// pointers or views, e.g. `template <> inline constexpr bool ltpl::enable_trivial_serialization<Point> = true;`.
+template <class T>
+inline constexpr bool enable_trivial_serialization = false;
+
+// Customization point for element types that are neither trivially serializable nor strings, vectors or Tuples.
+// Specializations provide `template <class Sink> static void write(Sink&, const T&)` and
+// `template <class Source> static bool read(Source&, T&)`, which are typically implemented in terms of
+// ltpl::serialize and ltpl::deserialize of a Tuple of the members.
+template <class T>
+struct Serializer
+{
+};
+
+namespace detail
+{
+template <class S>
+concept ByteSink = requires(S& sink, const std::byte* data, std::size_t size) { sink.write(data, size); };
+
+template <class S>
+concept ByteSource = requires(S& source, std::byte* data, std::size_t size) {
+    { source.read(data, size) } -> ConvertibleTo<bool>;
+};
+
+template <class T>
+concept HasSerializer = requires(VectorByteSink& sink, SpanByteSource& source, const T& cv, T& v) {
+    ltpl::Serializer<T>::write(sink, cv);
+    { ltpl::Serializer<T>::read(source, v) } -> ConvertibleTo<bool>;
+};
+
+// Pointers are trivially copyable but their value is meaningless in another process, and so is the value of class types
+// like std::string_view or std::span that hold them. Class types must therefore opt in.
+template <class T>
+inline constexpr bool is_trivially_serializable_v =
+    std::is_arithmetic_v<T> || std::is_enum_v<T> ||
+    (std::is_class_v<T> && std::is_trivially_copyable_v<T> && !IsTuple<T> && ltpl::enable_trivial_serialization<T>);
+
+template <class T, std::size_t N>
+inline constexpr bool is_trivially_serializable_v<std::array<T, N>> = is_trivially_serializable_v<T>;
+
+template <class T>
+inline constexpr bool is_string_v = false;
+
+template <class C, class Traits, class Allocator>
+inline constexpr bool is_string_v<std::basic_string<C, Traits, Allocator>> = true;
+
+template <class T>
+inline constexpr bool is_string_view_v = false;
+
+template <class C, class Traits>
+inline constexpr bool is_string_view_v<std::basic_string_view<C, Traits>> = true;
+
+template <class T>
+inline constexpr bool is_vector_v = false;
+
+template <class U, class Allocator>
+inline constexpr bool is_vector_v<std::vector<U, Allocator>> = true;
+
+template <class T>
+inline constexpr bool is_serializable_v =
+    is_trivially_serializable_v<T> || is_string_v<T> || is_string_view_v<T> || HasSerializer<T>;
+
+template <class U, class Allocator>
+inline constexpr bool is_serializable_v<std::vector<U, Allocator>> = is_serializable_v<U>;
+
+template <class Allocator>
+inline constexpr bool is_serializable_v<std::vector<bool, Allocator>> = false;
+
+template <class... T>
+inline constexpr bool is_serializable_v<ltpl::Tuple<T...>> = (is_serializable_v<std::remove_cvref_t<T>> && ... && true);
+
+// String views are written like strings but cannot own the bytes that are read back.
+template <class T>
+inline constexpr bool is_deserializable_v =
+    is_serializable_v<T> && !is_string_view_v<T> && std::is_default_constructible_v<T>;
+
+template <class U, class Allocator>
+inline constexpr bool is_deserializable_v<std::vector<U, Allocator>> = is_deserializable_v<U>;
+
+template <class Allocator>
+inline constexpr bool is_deserializable_v<std::vector<bool, Allocator>> = false;
+
+template <class... T>
+inline constexpr bool is_deserializable_v<ltpl::Tuple<T...>> =
+    ((std::is_same_v<T, std::remove_cvref_t<T>> && is_deserializable_v<T>) && ... && true);
+
+// The number of bytes of the trivially serializable elements, an upper bound for the length of a run of them.
+template <class... T>
+inline constexpr std::size_t trivial_run_capacity_v =
+    ((is_trivially_serializable_v<std::remove_cvref_t<T>> ? sizeof(std::remove_cvref_t<T>) : 0) + ... + std::size_t{});
+
+// Strings and vectors are read in chunks so that a corrupt length prefix fails on the missing bytes rather than on an
+// enormous allocation.
+inline constexpr std::size_t SERIALIZE_READ_CHUNK_SIZE = 64 * 1024;
+
+template <class Sink>
+void serialize_size(Sink& sink, std::size_t size)
+{
+    const auto value = static_cast<std::uint64_t>(size);
+    sink.write(reinterpret_cast<const std::byte*>(&value), sizeof(value));
+}
+
+template <class Source>
+bool deserialize_size(Source& source, std::size_t& size)
+{
+    std::uint64_t value{};
+    if (!source.read(reinterpret_cast<std::byte*>(&value), sizeof(value)) || value > SIZE_MAX)
+    {
+        return false;
+    }
+    size = static_cast<std::size_t>(value);
+    return true;
+}
+
+template <class Source, class Container>
+bool deserialize_trivial_elements(Source& source, Container& container, std::size_t size)
+{
+    using Element = typename Container::value_type;
+    constexpr auto CHUNK_ELEMENTS = std::max(SERIALIZE_READ_CHUNK_SIZE / sizeof(Element), std::size_t{1});
+    container.clear();
+    while (container.size() != size)
+    {
+        const auto offset = container.size();
+        const auto count = std::min(size - offset, CHUNK_ELEMENTS);
+        container.resize(offset + count);
+        if (!source.read(reinterpret_cast<std::byte*>(container.data() + offset), count * sizeof(Element)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <class Sink, class... T>
+void serialize_tuple(Sink& sink, const ltpl::Tuple<T...>& tuple);
+
+template <class Source, class... T>
+bool deserialize_tuple(Source& source, ltpl::Tuple<T...>& tuple);
+
+template <class Sink, class T>
+void serialize_value(Sink& sink, const T& value)
+{
+    if constexpr (is_trivially_serializable_v<T>)
+    {
+        sink.write(reinterpret_cast<const std::byte*>(&value), sizeof(T));
+    }
+    else if constexpr (IsTuple<T>)
+    {
+        detail::serialize_tuple(sink, value);
+    }
+    else if constexpr (is_string_v<T> || is_string_view_v<T>)
+    {
+        detail::serialize_size(sink, value.size());
+        sink.write(reinterpret_cast<const std::byte*>(value.data()), value.size() * sizeof(typename T::value_type));
+    }
+    else if constexpr (is_vector_v<T>)
+    {
+        detail::serialize_size(sink, value.size());
+        if constexpr (is_trivially_serializable_v<typename T::value_type>)
+        {
+            sink.write(reinterpret_cast<const std::byte*>(value.data()), value.size() * sizeof(typename T::value_type));
+        }
+        else
+        {
+            for (const auto& element : value)
+            {
+                detail::serialize_value(sink, element);
+            }
+        }
+    }
+    else
+    {
+        ltpl::Serializer<T>::write(sink, value);
+    }
+}
+
+template <class Source, class T>
+bool deserialize_value(Source& source, T& value)
+{
+    if constexpr (is_trivially_serializable_v<T>)
+    {
+        return source.read(reinterpret_cast<std::byte*>(&value), sizeof(T));
+    }
+    else if constexpr (IsTuple<T>)
+    {
+        return detail::deserialize_tuple(source, value);
+    }
+    else if constexpr (is_string_v<T> || is_vector_v<T>)
+    {
+        std::size_t size{};
+        if (!detail::deserialize_size(source, size))
+        {
+            return false;
+        }
+        if constexpr (is_trivially_serializable_v<typename T::value_type>)
+        {
+            return detail::deserialize_trivial_elements(source, value, size);
+        }
+        else
+        {
+            value.clear();
+            for (std::size_t i{}; i != size; ++i)
+            {
+                if (!detail::deserialize_value(source, value.emplace_back()))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+    else
+    {
+        return static_cast<bool>(ltpl::Serializer<T>::read(source, value));
+    }
+}
+
+// Consecutive trivially serializable elements are collected into a buffer and written with a single call to the sink.
+template <class Sink, class... T>
+void serialize_tuple(Sink& sink, const ltpl::Tuple<T...>& tuple)
+{
+    ltpl::apply(
+        [&](const auto&... v)
+        {
+            if constexpr (trivial_run_capacity_v<T...> == 0)
+            {
+                (detail::serialize_value(sink, v), ...);
+                return;
+            }
+            std::array<std::byte, trivial_run_capacity_v<T...>> run;
+            std::size_t run_size{};
+            const auto flush = [&]
+            {
+                if (run_size != 0)
+                {
+                    sink.write(run.data(), run_size);
+                    run_size = 0;
+                }
+            };
+            (
+                [&](const auto& element)
+                {
+                    using Element = std::remove_cvref_t<decltype(element)>;
+                    if constexpr (is_trivially_serializable_v<Element>)
+                    {
+                        std::memcpy(run.data() + run_size, &element, sizeof(Element));
+                        run_size += sizeof(Element);
+                    }
+                    else
+                    {
+                        flush();
+                        detail::serialize_value(sink, element);
+                    }
+                }(v),
+                ...);
+            flush();
+        },
+        tuple);
+}
+
+// Consecutive trivially serializable elements are read with a single call to the source. Tuples without such elements
+// skip the run buffer, whose `data()` would be null.
+template <class Source, class... T>
+bool deserialize_tuple(Source& source, ltpl::Tuple<T...>& tuple)
+{
+    return ltpl::apply(
+        [&](auto&... v)
+        {
+            if constexpr (trivial_run_capacity_v<T...> == 0)
+            {
+                return (true && ... && detail::deserialize_value(source, v));
+            }
+            std::array<std::byte, trivial_run_capacity_v<T...>> run;
+            std::array<std::pair<std::byte*, std::size_t>, sizeof...(T)> targets;
+            std::size_t run_size{};
+            std::size_t target_count{};
+            const auto flush = [&]
+            {
+                if (run_size == 0)
+                {
+                    return true;
+                }
+                if (!source.read(run.data(), run_size))
+                {
+                    return false;
+                }
+                const auto* data = run.data();
+                for (std::size_t i{}; i != target_count; ++i)
+                {
+                    std::memcpy(targets[i].first, data, targets[i].second);
+                    data += targets[i].second;
+                }
+                run_size = 0;
+                target_count = 0;
+                return true;
+            };
+            const auto read = [&](auto& element)
+            {
+                using Element = std::remove_cvref_t<decltype(element)>;
+                if constexpr (is_trivially_serializable_v<Element>)
+                {
+                    targets[target_count++] = {reinterpret_cast<std::byte*>(&element), sizeof(Element)};
+                    run_size += sizeof(Element);
+                    return true;
+                }
+                else
+                {
+                    return flush() && detail::deserialize_value(source, element);
+                }
+            };
+            return (true && ... && read(v)) && flush();
+        },
+        tuple);
+}
+
+// Rows of only trivially serializable elements are collected into chunks of about this size.
+inline constexpr std::size_t SERIALIZE_BATCH_CHUNK_SIZE = 4096;
+
+// The serialized size of a Tuple of only trivially serializable elements, zero for all other Tuples.
+template <class TupleT>
+inline constexpr std::size_t trivial_row_size_v = 0;
+
+template <class... T>
+inline constexpr std::size_t trivial_row_size_v<ltpl::Tuple<T...>> =
+    (is_trivially_serializable_v<std::remove_cvref_t<T>> && ... && true) ? trivial_run_capacity_v<T...> : 0;
+
+// Writes into a buffer that is known to be large enough.
+struct ChunkByteSink
+{
+    void write(const std::byte* data, std::size_t size) noexcept
+    {
+        std::memcpy(position, data, size);
+        position += size;
+    }
+
+    std::byte* position;
+};
+}  // namespace detail
+
+// Write the elements of the Tuple to `sink` in declaration order using the native byte order. Arithmetic types, enums,
+// std::arrays thereof and class types that opt in through ltpl::enable_trivial_serialization are written as raw bytes,
+// where consecutive ones are combined into a single write. Strings, string views and vectors are written as a 64-bit
+// length followed by their elements, nested Tuples recursively and all other types through ltpl::Serializer.
+template <class... T, class Sink>
+requires detail::ByteSink<Sink> && detail::is_serializable_v<ltpl::Tuple<T...>>
+void serialize(const ltpl::Tuple<T...>& tuple, Sink& sink)
+{
+    detail::serialize_tuple(sink, tuple);
+}
+
+// Read a Tuple that has been written by ltpl::serialize, e.g. `ltpl::deserialize<ltpl::Tuple<int, float>>(source)`.
+// Returns an empty optional if the source runs out of bytes.
+template <class TupleT, class Source>
+requires detail::IsTuple<TupleT> && detail::ByteSource<Source> && detail::is_deserializable_v<TupleT>
+[[nodiscard]] std::optional<TupleT> deserialize(Source& source)
+{
+    std::optional<TupleT> result{std::in_place};
+    if (!detail::deserialize_tuple(source, *result))
+    {
+        return std::nullopt;
+    }
+    return result;
+}
+
+// Write the number of Tuples followed by each Tuple as if by ltpl::serialize. Rows that consist only of elements that
+// are written as raw bytes are collected into chunks, so that the sink is invoked once per chunk rather than once per
+// row.
+template <class... T, class Sink>
+requires detail::ByteSink<Sink> && detail::is_serializable_v<ltpl::Tuple<T...>>
+void serialize_batch(std::span<const ltpl::Tuple<T...>> tuples, Sink& sink)
+{
+    detail::serialize_size(sink, tuples.size());
+    constexpr auto ROW_SIZE = detail::trivial_row_size_v<ltpl::Tuple<T...>>;
+    if constexpr (ROW_SIZE != 0)
+    {
+        constexpr auto CHUNK_ROWS = std::max(detail::SERIALIZE_BATCH_CHUNK_SIZE / ROW_SIZE, std::size_t{1});
+        std::array<std::byte, CHUNK_ROWS * ROW_SIZE> chunk;
+        for (std::size_t first{}; first < tuples.size(); first += CHUNK_ROWS)
+        {
+            const auto rows = std::min(tuples.size() - first, CHUNK_ROWS);
+            detail::ChunkByteSink chunk_sink{chunk.data()};
+            for (const auto& tuple : tuples.subspan(first, rows))
+            {
+                detail::serialize_tuple(chunk_sink, tuple);
+            }
+            sink.write(chunk.data(), rows * ROW_SIZE);
+        }
+    }
+    else
+    {
+        for (const auto& tuple : tuples)
+        {
+            detail::serialize_tuple(sink, tuple);
+        }
+    }
+}
+
+// Read Tuples that have been written by ltpl::serialize_batch. Returns an empty optional if the source runs out of
+// bytes.
+template <class TupleT, class Source>
+requires detail::IsTuple<TupleT> && detail::ByteSource<Source> && detail::is_deserializable_v<TupleT>
+[[nodiscard]] std::optional<std::vector<TupleT>> deserialize_batch(Source& source)
+{
+    std::size_t size{};
+    if (!detail::deserialize_size(source, size))
+    {
+        return std::nullopt;
+    }
+    std::optional<std::vector<TupleT>> result{std::in_place};
+    auto& tuples = *result;
+    constexpr auto ROW_SIZE = detail::trivial_row_size_v<TupleT>;
+    if constexpr (ROW_SIZE != 0)
+    {
+        constexpr auto CHUNK_ROWS = std::max(detail::SERIALIZE_BATCH_CHUNK_SIZE / ROW_SIZE, std::size_t{1});
+        std::array<std::byte, CHUNK_ROWS * ROW_SIZE> chunk;
+        while (tuples.size() != size)
+        {
+            const auto rows = std::min(size - tuples.size(), CHUNK_ROWS);
+            if (!source.read(chunk.data(), rows * ROW_SIZE))
+            {
+                return std::nullopt;
+            }
+            SpanByteSource chunk_source{std::span{chunk.data(), rows * ROW_SIZE}};
+            for (std::size_t i{}; i != rows; ++i)
+            {
+                (void)detail::deserialize_tuple(chunk_source, tuples.emplace_back());
+            }
+        }
+    }
+    else
+    {
+        for (std::size_t i{}; i != size; ++i)
+        {
+            if (!detail::deserialize_tuple(source, tuples.emplace_back()))
+            {
+                return std::nullopt;
+            }
+        }
+    }
+    return result;
+}
+}  // namespace ltpl
+
+#endif  // LTPL_LTPL_SERIALIZE_HPP
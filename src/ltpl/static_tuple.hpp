@@ -0,0 +1,119 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_STATIC_TUPLE_HPP
+#define LTPL_LTPL_STATIC_TUPLE_HPP
+
+#include <ltpl/tuple.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ltpl
+{
+namespace detail
+{
+template <std::size_t I, class T>
+struct StaticTupleLeaf
+{
+    T value{};
+
+    [[nodiscard]] friend constexpr bool operator==(const StaticTupleLeaf&, const StaticTupleLeaf&) = default;
+};
+
+template <class Sequence, class... T>
+struct StaticTupleLeaves;
+
+template <std::size_t... I, class... T>
+struct StaticTupleLeaves<std::index_sequence<I...>, T...> : StaticTupleLeaf<I, T>...
+{
+    StaticTupleLeaves() = default;
+
+    constexpr explicit StaticTupleLeaves(const T&... v) : StaticTupleLeaf<I, T>{v}... {}
+
+    [[nodiscard]] friend constexpr bool operator==(const StaticTupleLeaves&, const StaticTupleLeaves&) = default;
+};
+}  // namespace detail
+
+// A Tuple that is a structural type and can therefore be used as a non-type template parameter, e.g.
+// `template <ltpl::StaticTuple Config>`, provided that all element types are structural. Unlike ltpl::Tuple the
+// elements are stored as public members of base classes rather than lambda captures, because closure types are not
+// structural.
+template <class... T>
+struct StaticTuple : detail::StaticTupleLeaves<std::index_sequence_for<T...>, T...>
+{
+    StaticTuple() = default;
+
+    constexpr StaticTuple(const T&... v)  //
+    requires(sizeof...(T) >= 1)
+        : detail::StaticTupleLeaves<std::index_sequence_for<T...>, T...>(v...)
+    {
+    }
+
+    constexpr explicit StaticTuple(const ltpl::Tuple<T...>& tuple)
+        : detail::StaticTupleLeaves<std::index_sequence_for<T...>, T...>(ltpl::apply(
+              [](const T&... v)
+              {
+                  return detail::StaticTupleLeaves<std::index_sequence_for<T...>, T...>(v...);
+              },
+              tuple))
+    {
+    }
+
+    [[nodiscard]] constexpr explicit operator ltpl::Tuple<T...>() const
+    {
+        return [&]<std::size_t... I>(std::index_sequence<I...>)
+        {
+            return ltpl::Tuple<T...>{static_cast<const detail::StaticTupleLeaf<I, T>&>(*this).value...};
+        }(std::index_sequence_for<T...>{});
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(const StaticTuple&, const StaticTuple&) = default;
+};
+
+template <class... T>
+StaticTuple(T...) -> StaticTuple<T...>;
+
+template <class... T>
+StaticTuple(ltpl::Tuple<T...>) -> StaticTuple<T...>;
+
+template <std::size_t I, class... T>
+[[nodiscard]] constexpr std::tuple_element_t<I, StaticTuple<T...>>& get(StaticTuple<T...>& tuple) noexcept
+{
+    return static_cast<detail::StaticTupleLeaf<I, std::tuple_element_t<I, StaticTuple<T...>>>&>(tuple).value;
+}
+
+template <std::size_t I, class... T>
+[[nodiscard]] constexpr const std::tuple_element_t<I, StaticTuple<T...>>& get(const StaticTuple<T...>& tuple) noexcept
+{
+    return static_cast<const detail::StaticTupleLeaf<I, std::tuple_element_t<I, StaticTuple<T...>>>&>(tuple).value;
+}
+
+template <std::size_t I, class... T>
+[[nodiscard]] constexpr std::tuple_element_t<I, StaticTuple<T...>>&& get(StaticTuple<T...>&& tuple) noexcept
+{
+    return std::move(ltpl::get<I>(tuple));
+}
+
+template <std::size_t I, class... T>
+[[nodiscard]] constexpr const std::tuple_element_t<I, StaticTuple<T...>>&& get(const StaticTuple<T...>&& tuple) noexcept
+{
+    return std::move(ltpl::get<I>(tuple));
+}
+}  // namespace ltpl
+
+template <class... T>
+struct std::tuple_size<ltpl::StaticTuple<T...>> : std::integral_constant<std::size_t, sizeof...(T)>
+{
+};
+
+template <std::size_t I, class... T>
+struct std::tuple_element<I, ltpl::StaticTuple<T...>>
+{
+    using type = std::tuple_element_t<I, ltpl::Tuple<T...>>;
+};
+
+#endif  // LTPL_LTPL_STATIC_TUPLE_HPP
@@ -7,6 +7,7 @@
 #define LTPL_LTPL_TUPLE_HPP
 
 #include <array>
+#include <compare>
 #include <cstddef>
 #include <type_traits>
 #include <utility>
@@ -53,6 +54,34 @@ concept WeaklyEqualityComparableWith =
         { u != t } -> ConvertibleTo<bool>;
     };
 
+// Like the exposition-only `synth-three-way` of the standard library: uses `<=>` if available and falls back to `<`,
+// which is all that some standard library types provide before C++20.
+template <class T, class U>
+concept SynthThreeWayComparableWith =
+    requires(const std::remove_reference_t<T>& t, const std::remove_reference_t<U>& u) { t <=> u; } ||
+    requires(const std::remove_reference_t<T>& t, const std::remove_reference_t<U>& u) {
+        { t < u } -> ConvertibleTo<bool>;
+        { u < t } -> ConvertibleTo<bool>;
+    };
+
+template <class T, class U>
+constexpr auto synth_three_way(const T& t, const U& u)
+{
+    if constexpr (requires { t <=> u; })
+    {
+        return t <=> u;
+    }
+    else
+    {
+        return t < u ? std::weak_ordering::less : u < t ? std::weak_ordering::greater : std::weak_ordering::equivalent;
+    }
+}
+
+template <class T, class U>
+using SynthThreeWayResultT =
+    decltype(detail::synth_three_way(std::declval<const std::remove_reference_t<T>&>(),
+                                     std::declval<const std::remove_reference_t<U>&>()));
+
 // Not including <tuple> for std::tuple_size_v
 template <class T>
 inline constexpr std::size_t tuple_size_v = 1;
@@ -60,6 +89,15 @@ inline constexpr std::size_t tuple_size_v = 1;
 template <class... T>
 inline constexpr std::size_t tuple_size_v<ltpl::Tuple<T...>> = sizeof...(T);
 
+template <class T>
+inline constexpr bool is_tuple_v = false;
+
+template <class... T>
+inline constexpr bool is_tuple_v<ltpl::Tuple<T...>> = true;
+
+template <class T>
+concept IsTuple = is_tuple_v<std::remove_cvref_t<T>>;
+
 // Test that the types list does not contain just one element that is decay-equal to T.
 template <class T, class, class...>
 inline constexpr bool is_not_exactly_v = true;
@@ -379,6 +417,28 @@ class Tuple
             });
     }
 
+    // Lexicographical comparison, like that of `std::tuple`.
+    template <class... U>
+    [[nodiscard]] friend constexpr std::common_comparison_category_t<detail::SynthThreeWayResultT<T, U>...> operator<=>(
+        const Tuple& lhs, const Tuple<U...>& rhs)  //
+    requires(sizeof...(T) == sizeof...(U) && (detail::SynthThreeWayComparableWith<T, U> && ... && true))
+    {
+        return const_cast<Tuple&>(lhs).lambda(
+            [&rhs](const detail::WrapT<T>&... v_lhs)
+            {
+                return detail::Access::lambda(const_cast<Tuple<U...>&>(rhs))(
+                    [&](const detail::WrapT<U>&... v_rhs)
+                    {
+                        std::common_comparison_category_t<detail::SynthThreeWayResultT<T, U>...> result =
+                            std::strong_ordering::equal;
+                        (void)(true && ... &&
+                               ((result = detail::synth_three_way(static_cast<const T&>(v_lhs),
+                                                                  static_cast<const U&>(v_rhs))) == 0));
+                        return result;
+                    });
+            });
+    }
+
     template <class... U>
     friend constexpr void swap(Tuple& lhs, Tuple& rhs)             //
         noexcept((std::is_nothrow_swappable_v<T> && ... && true))  //
@@ -499,6 +559,48 @@ template <class... Tuples>
         return Ret{ltpl::get<indices[I].inner>(detail::get_nth<indices[I].outer>(static_cast<Tuples&&>(tuples)...))...};
     }(std::make_index_sequence<total_size>{});
 }
+
+// Invoke `f` with all elements of the Tuple in a single call to its storage lambda. The elements are passed with the
+// same value category that ltpl::get would return.
+template <class F, class... T>
+constexpr decltype(auto) apply(F&& f, Tuple<T...>& tuple)
+{
+    return detail::Access::lambda(tuple)(
+        [&](detail::WrapT<T>&... v) -> decltype(auto)
+        {
+            return static_cast<F&&>(f)(static_cast<T&>(v)...);
+        });
+}
+
+template <class F, class... T>
+constexpr decltype(auto) apply(F&& f, const Tuple<T...>& tuple)
+{
+    return detail::Access::lambda(const_cast<Tuple<T...>&>(tuple))(
+        [&](const detail::WrapT<T>&... v) -> decltype(auto)
+        {
+            return static_cast<F&&>(f)(static_cast<const T&>(v)...);
+        });
+}
+
+template <class F, class... T>
+constexpr decltype(auto) apply(F&& f, Tuple<T...>&& tuple)
+{
+    return detail::Access::lambda(tuple)(
+        [&](detail::WrapT<T>&... v) -> decltype(auto)
+        {
+            return static_cast<F&&>(f)(static_cast<T&&>(v)...);
+        });
+}
+
+template <class F, class... T>
+constexpr decltype(auto) apply(F&& f, const Tuple<T...>&& tuple)
+{
+    return detail::Access::lambda(const_cast<Tuple<T...>&>(tuple))(
+        [&](const detail::WrapT<T>&... v) -> decltype(auto)
+        {
+            return static_cast<F&&>(f)(static_cast<const T&&>(v)...);
+        });
+}
 }  // namespace ltpl
 
 template <std::size_t I, class... T>
@@ -0,0 +1,174 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_TUPLE_VIEW_HPP
+#define LTPL_LTPL_TUPLE_VIEW_HPP
+
+#include <ltpl/tuple.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace ltpl
+{
+namespace detail
+{
+template <class T>
+concept TupleViewElement = (std::is_arithmetic_v<T> || std::is_enum_v<T>) && std::is_same_v<T, std::remove_cvref_t<T>>;
+
+template <class... T>
+inline constexpr auto TUPLE_VIEW_OFFSETS = []
+{
+    std::array<std::size_t, sizeof...(T) + 1> offsets{};
+    std::size_t i{};
+    ((offsets[i + 1] = offsets[i] + sizeof(T), ++i), ...);
+    return offsets;
+}();
+
+template <std::endian Order, class T>
+T load_element(const std::byte* data) noexcept
+{
+    std::array<std::byte, sizeof(T)> bytes;
+    std::memcpy(bytes.data(), data, sizeof(T));
+    if constexpr (Order != std::endian::native)
+    {
+        std::reverse(bytes.begin(), bytes.end());
+    }
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        return bytes[0] != std::byte{};
+    }
+    else
+    {
+        return std::bit_cast<T>(bytes);
+    }
+}
+
+template <std::endian Order, class T>
+void store_element(const T& value, std::byte* data) noexcept
+{
+    auto bytes = std::bit_cast<std::array<std::byte, sizeof(T)>>(value);
+    if constexpr (Order != std::endian::native)
+    {
+        std::reverse(bytes.begin(), bytes.end());
+    }
+    std::memcpy(data, bytes.data(), sizeof(T));
+}
+}  // namespace detail
+
+// A read-only view of a record of `T...` in a span of bytes. The record layout is fixed: the elements are stored in
+// declaration order without padding, each in byte order `Order`, so element I starts at the sum of the sizes of the
+// elements before it. Elements are loaded on access with unaligned-safe copies, no other part of the record is read.
+// With native byte order the layout matches ltpl::serialize of an ltpl::Tuple<T...>.
+template <std::endian Order, detail::TupleViewElement... T>
+class BasicTupleView
+{
+  public:
+    // The number of bytes of a record.
+    static constexpr std::size_t size_bytes = detail::TUPLE_VIEW_OFFSETS<T...>[sizeof...(T)];
+
+    // The offset in bytes of element I within a record.
+    template <std::size_t I>
+    static constexpr std::size_t offset = detail::TUPLE_VIEW_OFFSETS<T...>[I];
+
+    // `bytes` must contain at least `size_bytes` bytes, any further bytes are ignored.
+    constexpr explicit BasicTupleView(std::span<const std::byte> bytes) noexcept : data_(bytes.data()) {}
+
+    [[nodiscard]] constexpr const std::byte* data() const noexcept { return data_; }
+
+    [[nodiscard]] explicit operator ltpl::Tuple<T...>() const
+    {
+        return [&]<std::size_t... I>(std::index_sequence<I...>)
+        {
+            return ltpl::Tuple<T...>{detail::load_element<Order, T>(data_ + offset<I>)...};
+        }(std::index_sequence_for<T...>{});
+    }
+
+    // Write `tuple` into `bytes` in the layout read by this view. `bytes` must contain at least `size_bytes` bytes.
+    static void write(const ltpl::Tuple<T...>& tuple, std::span<std::byte> bytes) noexcept
+    {
+        ltpl::apply(
+            [&](const T&... v)
+            {
+                [&]<std::size_t... I>(std::index_sequence<I...>)
+                {
+                    (detail::store_element<Order>(v, bytes.data() + offset<I>), ...);
+                }(std::index_sequence_for<T...>{});
+            },
+            tuple);
+    }
+
+    template <class... U>
+    [[nodiscard]] friend bool operator==(const BasicTupleView& lhs, const ltpl::Tuple<U...>& rhs)  //
+    requires(sizeof...(T) == sizeof...(U) && (detail::WeaklyEqualityComparableWith<T, U> && ... && true))
+    {
+        return ltpl::apply(
+            [&](const auto&... v)
+            {
+                return [&]<std::size_t... I>(std::index_sequence<I...>)
+                {
+                    return (true && ... && (detail::load_element<Order, T>(lhs.data_ + offset<I>) == v));
+                }(std::index_sequence_for<T...>{});
+            },
+            rhs);
+    }
+
+    // Lexicographical comparison, like that of ltpl::Tuple.
+    template <class... U>
+    [[nodiscard]] friend std::common_comparison_category_t<detail::SynthThreeWayResultT<T, U>...> operator<=>(
+        const BasicTupleView& lhs, const ltpl::Tuple<U...>& rhs)  //
+    requires(sizeof...(T) == sizeof...(U) && (detail::SynthThreeWayComparableWith<T, U> && ... && true))
+    {
+        return ltpl::apply(
+            [&](const auto&... v)
+            {
+                return [&]<std::size_t... I>(std::index_sequence<I...>)
+                {
+                    std::common_comparison_category_t<detail::SynthThreeWayResultT<T, U>...> result =
+                        std::strong_ordering::equal;
+                    (void)(true && ... &&
+                           ((result = detail::synth_three_way(detail::load_element<Order, T>(lhs.data_ + offset<I>),
+                                                              v)) == 0));
+                    return result;
+                }(std::index_sequence_for<T...>{});
+            },
+            rhs);
+    }
+
+  private:
+    const std::byte* data_;
+};
+
+// A view of a record in native byte order, see ltpl::BasicTupleView.
+template <class... T>
+using TupleView = ltpl::BasicTupleView<std::endian::native, T...>;
+
+template <std::size_t I, std::endian Order, class... T>
+[[nodiscard]] std::tuple_element_t<I, ltpl::Tuple<T...>> get(const BasicTupleView<Order, T...>& view) noexcept
+{
+    return detail::load_element<Order, std::tuple_element_t<I, ltpl::Tuple<T...>>>(
+        view.data() + BasicTupleView<Order, T...>::template offset<I>);
+}
+}  // namespace ltpl
+
+template <std::endian Order, class... T>
+struct std::tuple_size<ltpl::BasicTupleView<Order, T...>> : std::integral_constant<std::size_t, sizeof...(T)>
+{
+};
+
+template <std::size_t I, std::endian Order, class... T>
+struct std::tuple_element<I, ltpl::BasicTupleView<Order, T...>>
+{
+    using type = std::tuple_element_t<I, ltpl::Tuple<T...>>;
+};
+
+#endif  // LTPL_LTPL_TUPLE_VIEW_HPP
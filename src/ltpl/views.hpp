@@ -0,0 +1,536 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_VIEWS_HPP
+#define LTPL_LTPL_VIEWS_HPP
+
+#include <ltpl/tuple.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace ltpl
+{
+namespace detail
+{
+// libc++ does not provide `std::ranges::contiguous_range<T>`.
+template <class R>
+concept ContiguousSizedRange = requires(R& r) {
+    { std::data(r) } -> ConvertibleTo<const volatile void*>;
+    std::size(r);
+};
+
+template <class R>
+concept SizedRange = requires(R& r) { std::size(r); };
+
+template <class R>
+using IteratorT = decltype(std::begin(std::declval<R&>()));
+
+template <class R>
+using SentinelT = decltype(std::end(std::declval<R&>()));
+
+template <class R>
+using ElementPointerT = decltype(std::data(std::declval<R&>()));
+
+template <class R>
+concept RandomAccessSizedRange = SizedRange<R> && requires(R& r) { std::begin(r)[std::size_t{}]; };
+
+template <class R>
+using RandomAccessElementT = std::remove_reference_t<decltype(std::begin(std::declval<R&>())[std::size_t{}])>;
+
+// Iterator of a zip over contiguous ranges. Instead of advancing one iterator per range it only advances a single index
+// that is shared by all ranges.
+template <class... T>
+class ZipIndexIterator
+{
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
+    using value_type = ltpl::Tuple<std::remove_cv_t<T>...>;
+    using difference_type = std::ptrdiff_t;
+    using reference = ltpl::Tuple<T&...>;
+    using pointer = void;
+
+    ZipIndexIterator() = default;
+
+    constexpr ZipIndexIterator(ltpl::Tuple<T*...> data, difference_type index) noexcept : data(data), index(index) {}
+
+    [[nodiscard]] constexpr reference operator*() const noexcept { return (*this)[0]; }
+
+    [[nodiscard]] constexpr reference operator[](difference_type offset) const noexcept
+    {
+        return ltpl::apply(
+            [i = index + offset](T*... v)
+            {
+                return ltpl::tie(v[i]...);
+            },
+            data);
+    }
+
+    constexpr ZipIndexIterator& operator++() noexcept
+    {
+        ++index;
+        return *this;
+    }
+
+    constexpr ZipIndexIterator operator++(int) noexcept
+    {
+        auto self = *this;
+        ++index;
+        return self;
+    }
+
+    constexpr ZipIndexIterator& operator--() noexcept
+    {
+        --index;
+        return *this;
+    }
+
+    constexpr ZipIndexIterator operator--(int) noexcept
+    {
+        auto self = *this;
+        --index;
+        return self;
+    }
+
+    constexpr ZipIndexIterator& operator+=(difference_type offset) noexcept
+    {
+        index += offset;
+        return *this;
+    }
+
+    constexpr ZipIndexIterator& operator-=(difference_type offset) noexcept
+    {
+        index -= offset;
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr ZipIndexIterator operator+(ZipIndexIterator it, difference_type offset) noexcept
+    {
+        return it += offset;
+    }
+
+    [[nodiscard]] friend constexpr ZipIndexIterator operator+(difference_type offset, ZipIndexIterator it) noexcept
+    {
+        return it += offset;
+    }
+
+    [[nodiscard]] friend constexpr ZipIndexIterator operator-(ZipIndexIterator it, difference_type offset) noexcept
+    {
+        return it -= offset;
+    }
+
+    [[nodiscard]] friend constexpr difference_type operator-(const ZipIndexIterator& lhs,
+                                                             const ZipIndexIterator& rhs) noexcept
+    {
+        return lhs.index - rhs.index;
+    }
+
+    // Iterators are only comparable if they originate from the same zip, therefore comparing the index is sufficient.
+    [[nodiscard]] friend constexpr bool operator==(const ZipIndexIterator& lhs, const ZipIndexIterator& rhs) noexcept
+    {
+        return lhs.index == rhs.index;
+    }
+
+    [[nodiscard]] friend constexpr bool operator<(const ZipIndexIterator& lhs, const ZipIndexIterator& rhs) noexcept
+    {
+        return lhs.index < rhs.index;
+    }
+
+    [[nodiscard]] friend constexpr bool operator>(const ZipIndexIterator& lhs, const ZipIndexIterator& rhs) noexcept
+    {
+        return rhs < lhs;
+    }
+
+    [[nodiscard]] friend constexpr bool operator<=(const ZipIndexIterator& lhs, const ZipIndexIterator& rhs) noexcept
+    {
+        return !(rhs < lhs);
+    }
+
+    [[nodiscard]] friend constexpr bool operator>=(const ZipIndexIterator& lhs, const ZipIndexIterator& rhs) noexcept
+    {
+        return !(lhs < rhs);
+    }
+
+  private:
+    ltpl::Tuple<T*...> data;
+    difference_type index{};
+};
+
+template <class... S>
+struct ZipSentinel
+{
+    ltpl::Tuple<S...> sentinels;
+};
+
+// Iterator of a zip over arbitrary ranges, it advances one iterator per range.
+template <class... I>
+class ZipIterator
+{
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using iterator_concept = std::forward_iterator_tag;
+    using value_type = ltpl::Tuple<typename std::iterator_traits<I>::value_type...>;
+    using difference_type = std::ptrdiff_t;
+    using reference = ltpl::Tuple<std::iter_reference_t<I>...>;
+    using pointer = void;
+
+    ZipIterator() = default;
+
+    constexpr explicit ZipIterator(ltpl::Tuple<I...> iterators) noexcept : iterators(std::move(iterators)) {}
+
+    [[nodiscard]] constexpr reference operator*() const
+    {
+        return ltpl::apply(
+            [](const I&... it)
+            {
+                return reference(*it...);
+            },
+            iterators);
+    }
+
+    constexpr ZipIterator& operator++()
+    {
+        ltpl::apply(
+            [](I&... it)
+            {
+                (void(++it), ...);
+            },
+            iterators);
+        return *this;
+    }
+
+    constexpr ZipIterator operator++(int)
+    {
+        auto self = *this;
+        ++*this;
+        return self;
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(const ZipIterator& lhs, const ZipIterator& rhs)
+    {
+        return lhs.iterators == rhs.iterators;
+    }
+
+    // The zip ends as soon as the shortest range ends.
+    template <class... S>
+    [[nodiscard]] friend constexpr bool operator==(const ZipIterator& it, const ZipSentinel<S...>& sentinel)
+    {
+        return ltpl::apply(
+            [&](const I&... iterators)
+            {
+                return ltpl::apply(
+                    [&](const S&... sentinels)
+                    {
+                        return (false || ... || bool(iterators == sentinels));
+                    },
+                    sentinel.sentinels);
+            },
+            it.iterators);
+    }
+
+  private:
+    ltpl::Tuple<I...> iterators;
+};
+
+template <class... R>
+class CartesianProductIterator;
+}  // namespace detail
+
+namespace views
+{
+// A view over several ranges that are iterated in lockstep. Dereferencing its iterators yields a Tuple of references to
+// the elements of each range at the same position. Iteration stops at the end of the shortest range.
+// If all ranges are contiguous then the iterator is random-access and consists of the data pointers and a single index.
+template <class... R>
+class Zip
+{
+  private:
+    static constexpr bool is_contiguous = (detail::ContiguousSizedRange<R> && ...);
+
+  public:
+    constexpr explicit Zip(R&... ranges) noexcept : ranges(ranges...) {}
+
+    [[nodiscard]] constexpr auto begin() const
+    {
+        if constexpr (is_contiguous)
+        {
+            return detail::ZipIndexIterator<std::remove_pointer_t<detail::ElementPointerT<R>>...>(data(), 0);
+        }
+        else
+        {
+            return detail::ZipIterator<detail::IteratorT<R>...>(ltpl::apply(
+                [](R&... r)
+                {
+                    return ltpl::Tuple<detail::IteratorT<R>...>(std::begin(r)...);
+                },
+                ranges));
+        }
+    }
+
+    [[nodiscard]] constexpr auto end() const
+    {
+        if constexpr (is_contiguous)
+        {
+            return detail::ZipIndexIterator<std::remove_pointer_t<detail::ElementPointerT<R>>...>(
+                data(), static_cast<std::ptrdiff_t>(size()));
+        }
+        else
+        {
+            return detail::ZipSentinel<detail::SentinelT<R>...>{ltpl::apply(
+                [](R&... r)
+                {
+                    return ltpl::Tuple<detail::SentinelT<R>...>(std::end(r)...);
+                },
+                ranges)};
+        }
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const
+    requires(detail::SizedRange<R> && ...)
+    {
+        return ltpl::apply(
+            [](R&... r)
+            {
+                return std::min({static_cast<std::size_t>(std::size(r))...});
+            },
+            ranges);
+    }
+
+  private:
+    constexpr auto data() const noexcept
+    {
+        return ltpl::apply(
+            [](R&... r)
+            {
+                return ltpl::Tuple<detail::ElementPointerT<R>...>(std::data(r)...);
+            },
+            ranges);
+    }
+
+    ltpl::Tuple<R&...> ranges;
+};
+
+// Zip lvalue ranges, see ltpl::views::Zip.
+template <class... R>
+requires(sizeof...(R) > 0)
+[[nodiscard]] constexpr Zip<R...> zip(R&... ranges) noexcept
+{
+    return Zip<R...>(ranges...);
+}
+
+// A view over the Cartesian product of random-access ranges, yielding Tuples of references in the same order as nested
+// loops with the last range being the innermost one. Every element can also be accessed through its flat index in
+// constant time, which allows splitting the product into chunks for parallel processing. Nothing is allocated.
+template <class... R>
+class CartesianProduct
+{
+  public:
+    using iterator = detail::CartesianProductIterator<R...>;
+
+    constexpr explicit CartesianProduct(R&... ranges) noexcept(noexcept((std::size(ranges), ...)))
+        : ranges(ranges...), sizes{static_cast<std::size_t>(std::size(ranges))...}
+    {
+    }
+
+    [[nodiscard]] constexpr iterator begin() const noexcept { return iterator(*this, 0); }
+
+    [[nodiscard]] constexpr iterator end() const noexcept { return iterator(*this, size()); }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        std::size_t result{1};
+        for (auto size : sizes)
+        {
+            result *= size;
+        }
+        return result;
+    }
+
+    [[nodiscard]] constexpr ltpl::Tuple<detail::RandomAccessElementT<R>&...> operator[](std::size_t index) const
+    {
+        return element(positions(index));
+    }
+
+  private:
+    friend iterator;
+
+    using Positions = std::array<std::size_t, sizeof...(R)>;
+
+    constexpr Positions positions(std::size_t index) const noexcept
+    {
+        Positions result{};
+        if (index >= size())
+        {
+            // Positions of the end iterator are never used, this also avoids dividing by zero for empty products.
+            return result;
+        }
+        for (std::size_t i = sizeof...(R); i != 0; --i)
+        {
+            result[i - 1] = index % sizes[i - 1];
+            index /= sizes[i - 1];
+        }
+        return result;
+    }
+
+    constexpr ltpl::Tuple<detail::RandomAccessElementT<R>&...> element(const Positions& positions) const
+    {
+        return [&]<std::size_t... I>(std::index_sequence<I...>)
+        {
+            return ltpl::tie(std::begin(ltpl::get<I>(ranges))[positions[I]]...);
+        }(std::make_index_sequence<sizeof...(R)>{});
+    }
+
+    ltpl::Tuple<R&...> ranges;
+    Positions sizes;
+};
+
+// Form the Cartesian product of lvalue random-access ranges, see ltpl::views::CartesianProduct.
+template <detail::RandomAccessSizedRange... R>
+requires(sizeof...(R) > 0)
+[[nodiscard]] constexpr CartesianProduct<R...> cartesian_product(R&... ranges)
+{
+    return CartesianProduct<R...>(ranges...);
+}
+}  // namespace views
+
+namespace detail
+{
+// Iterator of a Cartesian product. Sequential iteration advances the position within each range like an odometer,
+// random-access jumps recompute all positions from the flat index.
+template <class... R>
+class CartesianProductIterator
+{
+  private:
+    using View = views::CartesianProduct<R...>;
+
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
+    using value_type = ltpl::Tuple<std::remove_cv_t<RandomAccessElementT<R>>...>;
+    using difference_type = std::ptrdiff_t;
+    using reference = ltpl::Tuple<RandomAccessElementT<R>&...>;
+    using pointer = void;
+
+    CartesianProductIterator() = default;
+
+    constexpr CartesianProductIterator(const View& view, std::size_t index) noexcept
+        : view(&view), positions(view.positions(index)), index(index)
+    {
+    }
+
+    [[nodiscard]] constexpr reference operator*() const { return view->element(positions); }
+
+    [[nodiscard]] constexpr reference operator[](difference_type offset) const
+    {
+        return (*view)[index + static_cast<std::size_t>(offset)];
+    }
+
+    constexpr CartesianProductIterator& operator++() noexcept
+    {
+        ++index;
+        for (std::size_t i = sizeof...(R); i != 0; --i)
+        {
+            if (++positions[i - 1] != view->sizes[i - 1])
+            {
+                break;
+            }
+            positions[i - 1] = 0;
+        }
+        return *this;
+    }
+
+    constexpr CartesianProductIterator operator++(int) noexcept
+    {
+        auto self = *this;
+        ++*this;
+        return self;
+    }
+
+    constexpr CartesianProductIterator& operator--() noexcept { return *this -= 1; }
+
+    constexpr CartesianProductIterator operator--(int) noexcept
+    {
+        auto self = *this;
+        --*this;
+        return self;
+    }
+
+    constexpr CartesianProductIterator& operator+=(difference_type offset) noexcept
+    {
+        index += static_cast<std::size_t>(offset);
+        positions = view->positions(index);
+        return *this;
+    }
+
+    constexpr CartesianProductIterator& operator-=(difference_type offset) noexcept { return *this += -offset; }
+
+    [[nodiscard]] friend constexpr CartesianProductIterator operator+(CartesianProductIterator it,
+                                                                      difference_type offset) noexcept
+    {
+        return it += offset;
+    }
+
+    [[nodiscard]] friend constexpr CartesianProductIterator operator+(difference_type offset,
+                                                                      CartesianProductIterator it) noexcept
+    {
+        return it += offset;
+    }
+
+    [[nodiscard]] friend constexpr CartesianProductIterator operator-(CartesianProductIterator it,
+                                                                      difference_type offset) noexcept
+    {
+        return it -= offset;
+    }
+
+    [[nodiscard]] friend constexpr difference_type operator-(const CartesianProductIterator& lhs,
+                                                             const CartesianProductIterator& rhs) noexcept
+    {
+        return static_cast<difference_type>(lhs.index - rhs.index);
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(const CartesianProductIterator& lhs,
+                                                   const CartesianProductIterator& rhs) noexcept
+    {
+        return lhs.index == rhs.index;
+    }
+
+    [[nodiscard]] friend constexpr bool operator<(const CartesianProductIterator& lhs,
+                                                  const CartesianProductIterator& rhs) noexcept
+    {
+        return lhs.index < rhs.index;
+    }
+
+    [[nodiscard]] friend constexpr bool operator>(const CartesianProductIterator& lhs,
+                                                  const CartesianProductIterator& rhs) noexcept
+    {
+        return rhs < lhs;
+    }
+
+    [[nodiscard]] friend constexpr bool operator<=(const CartesianProductIterator& lhs,
+                                                   const CartesianProductIterator& rhs) noexcept
+    {
+        return !(rhs < lhs);
+    }
+
+    [[nodiscard]] friend constexpr bool operator>=(const CartesianProductIterator& lhs,
+                                                   const CartesianProductIterator& rhs) noexcept
+    {
+        return !(lhs < rhs);
+    }
+
+  private:
+    const View* view{};
+    std::array<std::size_t, sizeof...(R)> positions{};
+    std::size_t index{};
+};
+}  // namespace detail
+}  // namespace ltpl
+
+#endif  // LTPL_LTPL_VIEWS_HPP
@@ -0,0 +1,138 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_LTPL_VISIT_HPP
+#define LTPL_LTPL_VISIT_HPP
+
+#include <ltpl/tuple.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace ltpl
+{
+namespace detail
+{
+template <class... T>
+struct VariantTypes
+{
+    template <class... U>
+    friend constexpr VariantTypes<T..., U...> operator+(VariantTypes, VariantTypes<U...>) noexcept
+    {
+        return {};
+    }
+};
+
+// std::variant cannot hold void or references, visitors that return nothing produce a std::monostate instead.
+template <class T>
+using VariantAlternativeT = std::conditional_t<std::is_void_v<T>, std::monostate, std::remove_cvref_t<T>>;
+
+template <std::size_t I, class... T>
+using NthT = typename std::remove_cvref_t<decltype(detail::get_nth<I>(std::type_identity<T>{}...))>::type;
+
+// The I-th result type is an alternative of the variant only if it does not already appear at a lower index.
+template <std::size_t I, class... R>
+constexpr bool is_first_occurrence() noexcept
+{
+    return [&]<std::size_t... J>(std::index_sequence<J...>)
+    {
+        return (true && ... &&
+                !std::is_same_v<VariantAlternativeT<NthT<J, R...>>, VariantAlternativeT<NthT<I, R...>>>);
+    }(std::make_index_sequence<I>{});
+}
+
+template <class... R>
+struct VisitVariant
+{
+    template <std::size_t... I>
+    static auto deduplicate(std::index_sequence<I...>)
+        -> decltype((VariantTypes<>{} + ... +
+                     std::conditional_t<detail::is_first_occurrence<I, R...>(),
+                                        VariantTypes<VariantAlternativeT<NthT<I, R...>>>, VariantTypes<>>{}));
+
+    template <class... U>
+    static std::variant<U...> to_variant(VariantTypes<U...>);
+
+    using Type = decltype(to_variant(deduplicate(std::make_index_sequence<sizeof...(R)>{})));
+};
+
+template <class, class... R>
+struct VisitResult
+{
+    using Type = typename VisitVariant<R...>::Type;
+};
+
+// All visitors return exactly the same type, e.g. `void` or `int&`.
+template <class R0, class... R>
+requires(std::is_same_v<R0, R> && ... && true)
+struct VisitResult<void, R0, R...>
+{
+    using Type = R0;
+};
+
+// The results of the visitors have a common type, e.g. `int` and `long`.
+template <class R0, class... R>
+requires(!(std::is_same_v<R0, R> && ... && true))
+struct VisitResult<std::void_t<std::common_type_t<R0, R...>>, R0, R...>
+{
+    using Type = std::common_type_t<R0, R...>;
+};
+
+template <class T>
+inline constexpr bool is_variant_v = false;
+
+template <class... T>
+inline constexpr bool is_variant_v<std::variant<T...>> = true;
+
+template <class Tuple, class F, class = std::make_index_sequence<std::tuple_size<std::remove_cvref_t<Tuple>>::value>>
+struct VisitAt;
+
+template <class Tuple, class F, std::size_t... I>
+struct VisitAt<Tuple, F, std::index_sequence<I...>>
+{
+    using Result =
+        typename VisitResult<void, decltype(std::declval<F>()(ltpl::get<I>(std::declval<Tuple>())))...>::Type;
+
+    template <std::size_t Index>
+    static constexpr Result invoke(Tuple&& tuple, F&& f)
+    {
+        using IndexResult = decltype(static_cast<F&&>(f)(ltpl::get<Index>(static_cast<Tuple&&>(tuple))));
+        if constexpr (!is_variant_v<Result>)
+        {
+            return static_cast<Result>(static_cast<F&&>(f)(ltpl::get<Index>(static_cast<Tuple&&>(tuple))));
+        }
+        else if constexpr (std::is_void_v<IndexResult>)
+        {
+            static_cast<F&&>(f)(ltpl::get<Index>(static_cast<Tuple&&>(tuple)));
+            return Result{std::monostate{}};
+        }
+        else
+        {
+            return Result{std::in_place_type<std::remove_cvref_t<IndexResult>>,
+                          static_cast<F&&>(f)(ltpl::get<Index>(static_cast<Tuple&&>(tuple)))};
+        }
+    }
+
+    // One entry per element, each entry only performs a compile-time get<I> on the storage lambda.
+    static constexpr std::array<Result (*)(Tuple&&, F&&), sizeof...(I)> table{&VisitAt::invoke<I>...};
+};
+}  // namespace detail
+
+// Invoke `f` with a reference to the element at runtime index `i` through a jump table that is built at compile time.
+// The result is the type returned by all invocations of `f` if they agree, otherwise their std::common_type or, lacking
+// that, a std::variant of the decayed results where `void` is represented by std::monostate.
+// The behavior is undefined if `i` is not less than the size of the Tuple.
+template <detail::IsTuple Tuple, class F>
+requires(std::tuple_size<std::remove_cvref_t<Tuple>>::value > 0)
+constexpr decltype(auto) visit_at(Tuple&& tuple, std::size_t i, F&& f)
+{
+    return detail::VisitAt<Tuple, F>::table[i](static_cast<Tuple&&>(tuple), static_cast<F&&>(f));
+}
+}  // namespace ltpl
+
+#endif  // LTPL_LTPL_VISIT_HPP
@@ -5,17 +5,40 @@
 
 #include <test.hpp>
 #include <test/framework.hpp>
+#include <test_algorithm.hpp>
+#include <test_arithmetic.hpp>
+#include <test_arrow.hpp>
 #include <test_cat.hpp>
+#include <test_cat_view.hpp>
+#include <test_compact_encoding.hpp>
 #include <test_comparison.hpp>
+#include <test_compressed_tuple_batch.hpp>
 #include <test_constructor.hpp>
 #include <test_copy_assignment.hpp>
+#include <test_csv_reader.hpp>
 #include <test_dev10_646556_construct_tuple_from_const.hpp>
 #include <test_dev10_661739_tuple_copy_ctors.hpp>
 #include <test_dev11_0343056_pair_tuple_ctor_sfinae.hpp>
 #include <test_dev11_0607540_pair_tuple_rvalue_references.hpp>
+#include <test_flat_tuple_map.hpp>
+#include <test_flatten.hpp>
+#include <test_functional.hpp>
+#include <test_hash.hpp>
+#include <test_homogeneous_tuple.hpp>
+#include <test_lazy_tuple.hpp>
+#include <test_mapped_tuple_table.hpp>
+#include <test_memoize.hpp>
 #include <test_move_assignment.hpp>
+#include <test_radix_sort.hpp>
+#include <test_record_log.hpp>
+#include <test_select.hpp>
+#include <test_serialize.hpp>
+#include <test_static_tuple.hpp>
 #include <test_structured_binding.hpp>
 #include <test_swap.hpp>
+#include <test_tuple_view.hpp>
+#include <test_views.hpp>
+#include <test_visit.hpp>
 
 int main()
 {
@@ -32,6 +55,9 @@ int main()
     run_test<&test_equality_compare_value_const_lref<StdTuple>>();
     run_test<&test_equality_compare_value_rref<LambdaTuple>>();
     run_test<&test_equality_compare_value_rref<StdTuple>>();
+    run_test<&test_three_way_compare<LambdaTuple>>();
+    run_test<&test_three_way_compare<StdTuple>>();
+    run_test<&test_three_way_compare_reference>();
     run_test<test_not_equality_comparable>();
 
     // test_constructor
@@ -176,6 +202,140 @@ int main()
     // test_cat
     run_test<&test_tuple_cat>();
 
+    // test_cat_view
+    run_test<&test_cat_view>();
+    run_test<&test_cat_view_rvalue>();
+    run_test<&test_cat_view_owning>();
+    run_test<&test_apply>();
+
+    // test_views
+    run_test<&test_zip_contiguous>();
+    run_test<&test_zip_non_contiguous>();
+    run_test<&test_zip_proxy_reference>();
+    run_test<&test_zip_index_loop>();
+    run_test<&test_cartesian_product>();
+    run_test<&test_cartesian_product_chunked>();
+
+    // test_flatten
+    run_test<&test_flat_tuple_t>();
+    run_test<&test_get_path>();
+    run_test<&test_flatten>();
+
+    // test_hash
+    run_test<&test_hash>();
+    run_test<&test_hash_bytewise>();
+    run_test<&test_hash_batch>();
+
+    // test_flat_tuple_map
+    run_test<&test_flat_tuple_map>();
+    run_test<&test_flat_tuple_map_heterogeneous_lookup>();
+    run_test<&test_flat_tuple_map_growth>();
+
+    // test_memoize
+    run_test<&test_memoize>();
+    run_test<&test_memoize_copies_arguments_only_on_miss>();
+    run_test<&test_memoize_reference_parameters_and_results>();
+    run_test<&test_memoize_clock_eviction>();
+    run_test<&test_memoize_sharded>();
+
+    // test_functional
+    run_test<&test_transparent_less>();
+    run_test<&test_transparent_equal_and_hash>();
+    run_test<&test_order_by>();
+    run_test<&test_equal_by>();
+
+    // test_radix_sort
+    run_test<&test_encode_key>();
+    run_test<&test_radix_sort>();
+    run_test<&test_radix_sort_long_common_prefix>();
+
+    // test_serialize
+    run_test<&test_serialize>();
+    run_test<&test_serialize_trivial_class_types>();
+    run_test<&test_serialize_combines_trivial_elements>();
+    run_test<&test_serialize_batch>();
+
+    // test_compact_encoding
+    run_test<&test_compact_encode>();
+    run_test<&test_compact_decode>();
+    run_test<&test_compact_decode_small_integers>();
+    run_test<&test_compact_encoding_bool_enum>();
+
+    // test_tuple_view
+    run_test<&test_tuple_view>();
+    run_test<&test_tuple_view_comparison>();
+    run_test<&test_tuple_view_byte_order>();
+    run_test<&test_tuple_view_over_serialized_records>();
+
+    // test_mapped_tuple_table
+    run_test<&test_mapped_tuple_table>();
+    run_test<&test_mapped_tuple_table_validation>();
+    run_test<&test_mapped_tuple_table_empty>();
+
+    // test_csv_reader
+    run_test<&test_csv_reader>();
+    run_test<&test_csv_reader_floating_point<>>();
+    run_test<&test_csv_reader_invalid_rows>();
+    run_test<&test_csv_reader_quote_inside_unquoted_field>();
+    run_test<&test_csv_reader_string_view_and_small_buffer>();
+    run_test<&test_csv_reader_columns>();
+
+    // test_arrow
+    run_test<&test_arrow_round_trip>();
+    run_test<&test_arrow_consumer>();
+    run_test<&test_arrow_import_mismatch>();
+
+    // test_record_log
+    run_test<&test_record_log>();
+    run_test<&test_record_log_concurrent>();
+    run_test<&test_record_log_recovery>();
+
+    // test_compressed_tuple_batch
+    run_test<&test_compressed_tuple_batch>();
+    run_test<&test_compressed_column>();
+
+    // test_algorithm
+    run_test<&test_for_each>();
+    run_test<&test_for_each_indexed>();
+    run_test<&test_transform>();
+    run_test<&test_fold>();
+    run_test<&test_any_all_none_of>();
+    run_test<&test_find_if>();
+    run_test<&test_algorithm_cat_view>();
+
+    // test_arithmetic
+    run_test<&test_arithmetic_operators>();
+    run_test<&test_arithmetic_compound_assignment>();
+    run_test<&test_arithmetic_min_max>();
+    run_test<&test_arithmetic_homogeneous_tuple>();
+
+    // test_visit
+    run_test<&test_visit_at_common_type>();
+    run_test<&test_visit_at_reference>();
+    run_test<&test_visit_at_variant>();
+
+    // test_homogeneous_tuple
+    run_test<&test_homogeneous_tuple>();
+    run_test<&test_homogeneous_tuple_conversion>();
+    run_test<&test_tuple_as_span_disabled>();
+
+    // test_lazy_tuple
+    run_test<&test_lazy_tuple>();
+    run_test<&test_lazy_tuple_structured_binding>();
+    run_test<&test_lazy_tuple_retries_after_exception>();
+    run_test<&test_synchronized_lazy_tuple>();
+
+    // test_select
+    run_test<&test_select_by_index>();
+    run_test<&test_select_by_index_rvalue>();
+    run_test<&test_select_by_type>();
+    run_test<&test_drop>();
+
+    // test_static_tuple
+    run_test<&test_static_tuple>();
+    run_test<&test_static_tuple_conversion>();
+    run_test<&test_static_tuple_as_template_parameter>();
+
     print_test_results();
     return context.failed_tests;
 }
\ No newline at end of file
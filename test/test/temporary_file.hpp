@@ -0,0 +1,33 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEMPORARY_FILE_HPP
+#define LTPL_TEST_TEMPORARY_FILE_HPP
+
+#include <filesystem>
+#include <string>
+#include <system_error>
+
+namespace test
+{
+// Removes the file on destruction.
+struct TemporaryFile
+{
+    explicit TemporaryFile(const std::string& name)
+        : path(std::filesystem::temp_directory_path() / ("lambda-tuple-test-" + name))
+    {
+    }
+
+    ~TemporaryFile() noexcept
+    {
+        std::error_code error;
+        std::filesystem::remove(path, error);
+    }
+
+    std::filesystem::path path;
+};
+}  // namespace test
+
+#endif  // LTPL_TEST_TEMPORARY_FILE_HPP
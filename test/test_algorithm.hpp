@@ -0,0 +1,189 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_ALGORITHM_HPP
+#define LTPL_TEST_TEST_ALGORITHM_HPP
+
+#include <ltpl/algorithm.hpp>
+#include <ltpl/cat_view.hpp>
+#include <ltpl/tuple.hpp>
+#include <test/framework.hpp>
+#include <test/utility.hpp>
+
+#include <string>
+
+namespace test
+{
+void test_for_each()
+{
+    ltpl::Tuple<int, std::string, double> tuple{1, "a", 2.};
+    std::string result;
+    ltpl::for_each(tuple,
+                   [&]<class T>(T& v)
+                   {
+                       if constexpr (std::is_same_v<std::string, T>)
+                       {
+                           result += v;
+                       }
+                       else
+                       {
+                           result += std::to_string(static_cast<int>(v));
+                       }
+                   });
+    CHECK_EQ("1a2", result);
+    ltpl::Tuple<MoveOnly, MoveOnly> move_only{MoveOnly{1}, MoveOnly{2}};
+    ltpl::for_each(std::move(move_only),
+                   [](MoveOnly&& v)
+                   {
+                       MoveOnly other{std::move(v)};
+                   });
+    CHECK(ltpl::get<0>(move_only).is_moved_from);
+    CHECK(ltpl::get<1>(move_only).is_moved_from);
+}
+
+void test_for_each_indexed()
+{
+    ltpl::Tuple<int, int, int> tuple{1, 2, 3};
+    ltpl::for_each_indexed(tuple,
+                           [](auto index, int& v)
+                           {
+                               static_assert(decltype(index)::value < 3);
+                               v *= static_cast<int>(index.value);
+                           });
+    CHECK_EQ((ltpl::Tuple<int, int, int>{0, 2, 6}), tuple);
+}
+
+void test_transform()
+{
+    const ltpl::Tuple<int, std::string> tuple{1, "a"};
+    auto sizes = ltpl::transform(tuple,
+                                 []<class T>(const T& v)
+                                 {
+                                     if constexpr (std::is_same_v<std::string, T>)
+                                     {
+                                         return v.size();
+                                     }
+                                     else
+                                     {
+                                         return v * 2.;
+                                     }
+                                 });
+    CHECK(std::is_same_v<ltpl::Tuple<double, std::size_t>, decltype(sizes)>);
+    CHECK_EQ((ltpl::Tuple<double, std::size_t>{2., 1u}), sizes);
+    ltpl::Tuple<int, int> ints{1, 2};
+    auto references = ltpl::transform(ints,
+                                      [](int& v) -> int&
+                                      {
+                                          return v;
+                                      });
+    CHECK(std::is_same_v<ltpl::Tuple<int&, int&>, decltype(references)>);
+    int order{};
+    auto evaluation_order = ltpl::transform(ints,
+                                            [&](int)
+                                            {
+                                                return order++;
+                                            });
+    CHECK_EQ((ltpl::Tuple<int, int>{0, 1}), evaluation_order);
+}
+
+void test_fold()
+{
+    const ltpl::Tuple<int, std::string, char> tuple{1, "b", 'c'};
+    auto concatenate = [](auto lhs, const auto& rhs)
+    {
+        if constexpr (std::is_same_v<int, std::remove_cvref_t<decltype(rhs)>>)
+        {
+            return lhs + std::to_string(rhs);
+        }
+        else
+        {
+            return lhs + rhs;
+        }
+    };
+    CHECK_EQ("a1bc", ltpl::fold_left(tuple, std::string{"a"}, concatenate));
+    auto prepend = [](const auto& lhs, std::string rhs)
+    {
+        if constexpr (std::is_same_v<int, std::remove_cvref_t<decltype(lhs)>>)
+        {
+            return std::to_string(lhs) + rhs;
+        }
+        else
+        {
+            return lhs + rhs;
+        }
+    };
+    CHECK_EQ("1bca", ltpl::fold_right(tuple, std::string{"a"}, prepend));
+    auto subtract = [](auto lhs, auto rhs)
+    {
+        return lhs - rhs;
+    };
+    static constexpr ltpl::Tuple<int, long, double> constant{1, 2L, 3.};
+    static_assert(-6. == ltpl::fold_left(constant, 0, subtract));
+    static_assert(2. == ltpl::fold_right(constant, 0, subtract));
+    CHECK_EQ(42, ltpl::fold_left(ltpl::Tuple<>{}, 42, subtract));
+}
+
+void test_any_all_none_of()
+{
+    ltpl::Tuple<int, double, long> tuple{1, -2., 3L};
+    int invocations{};
+    auto is_negative = [&](auto v)
+    {
+        ++invocations;
+        return v < 0;
+    };
+    CHECK(ltpl::any_of(tuple, is_negative));
+    CHECK_EQ(2, invocations);
+    invocations = 0;
+    CHECK_FALSE(ltpl::all_of(tuple, is_negative));
+    CHECK_EQ(1, invocations);
+    CHECK_FALSE(ltpl::none_of(tuple, is_negative));
+    CHECK(ltpl::all_of(ltpl::Tuple<>{}, is_negative));
+    CHECK_FALSE(ltpl::any_of(ltpl::Tuple<>{}, is_negative));
+}
+
+void test_find_if()
+{
+    ltpl::Tuple<int, double, long, int> tuple{1, -2., -3L, 4};
+    int invocations{};
+    auto is_negative = [&](auto v)
+    {
+        ++invocations;
+        return v < 0;
+    };
+    CHECK_EQ(1u, ltpl::find_if(tuple, is_negative));
+    CHECK_EQ(2, invocations);
+    CHECK_EQ(4u, ltpl::find_if(tuple,
+                               [](auto v)
+                               {
+                                   return v > 10;
+                               }));
+}
+
+void test_algorithm_cat_view()
+{
+    ltpl::Tuple<int, int> first{1, 2};
+    ltpl::Tuple<int> second{3};
+    auto view = ltpl::cat_view(first, second);
+    ltpl::for_each(view,
+                   [](int& v)
+                   {
+                       v *= 2;
+                   });
+    CHECK_EQ(6, ltpl::get<0>(second));
+    CHECK_EQ(12, ltpl::fold_left(view, 0,
+                                 [](int lhs, int rhs)
+                                 {
+                                     return lhs + rhs;
+                                 }));
+    CHECK_EQ(2u, ltpl::find_if(view,
+                               [](int v)
+                               {
+                                   return v == 6;
+                               }));
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_ALGORITHM_HPP
@@ -0,0 +1,95 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_ARITHMETIC_HPP
+#define LTPL_TEST_TEST_ARITHMETIC_HPP
+
+#include <ltpl/arithmetic.hpp>
+#include <ltpl/homogeneous_tuple.hpp>
+#include <ltpl/tuple.hpp>
+#include <test/framework.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace test
+{
+namespace arithmetic_scope
+{
+using namespace ltpl::arithmetic;
+
+template <class Lhs, class Rhs>
+concept HasPlus = requires(const Lhs& lhs, const Rhs& rhs) { lhs + rhs; };
+
+template <class Lhs, class Rhs>
+concept HasMinusAssign = requires(Lhs& lhs, const Rhs& rhs) { lhs -= rhs; };
+}  // namespace arithmetic_scope
+
+void test_arithmetic_operators()
+{
+    using namespace ltpl::arithmetic;
+    const ltpl::Tuple<double, std::int64_t> lhs{1.5, 10};
+    const ltpl::Tuple<double, std::int64_t> rhs{0.5, 4};
+    CHECK_EQ((ltpl::Tuple<double, std::int64_t>{2., 14}), lhs + rhs);
+    CHECK_EQ((ltpl::Tuple<double, std::int64_t>{1., 6}), lhs - rhs);
+    CHECK_EQ((ltpl::Tuple<double, std::int64_t>{0.75, 40}), lhs * rhs);
+    CHECK_EQ((ltpl::Tuple<double, std::int64_t>{3., 2}), lhs / rhs);
+    CHECK((std::is_same_v<ltpl::Tuple<double, long>,
+                          decltype(ltpl::Tuple<float, int>{} + ltpl::Tuple<double, long>{})>));
+    static_assert(ltpl::get<1>(ltpl::Tuple{1, 2} * ltpl::Tuple{3, 4}) == 8);
+    CHECK((arithmetic_scope::HasPlus<ltpl::Tuple<int>, ltpl::Tuple<long>>));
+    CHECK_FALSE((arithmetic_scope::HasPlus<ltpl::Tuple<int>, ltpl::Tuple<int, int>>));
+    CHECK_FALSE((arithmetic_scope::HasPlus<ltpl::Tuple<int*>, ltpl::Tuple<int*>>));
+}
+
+void test_arithmetic_compound_assignment()
+{
+    using namespace ltpl::arithmetic;
+    ltpl::Tuple<double, int> tuple{1., 2};
+    tuple += ltpl::Tuple{2., 3};
+    CHECK_EQ((ltpl::Tuple{3., 5}), tuple);
+    tuple -= ltpl::Tuple{1, 1};
+    CHECK_EQ((ltpl::Tuple{2., 4}), tuple);
+    tuple *= ltpl::Tuple{2., 3};
+    CHECK_EQ((ltpl::Tuple{4., 12}), tuple);
+    tuple /= ltpl::Tuple{4., 4};
+    CHECK_EQ((ltpl::Tuple{1., 3}), tuple);
+    double d{1.};
+    int i{2};
+    auto tie = ltpl::tie(d, i);
+    tie += ltpl::Tuple{1., 1};
+    CHECK_EQ(2., d);
+    CHECK_EQ(3, i);
+    CHECK((arithmetic_scope::HasMinusAssign<ltpl::Tuple<double, int>, ltpl::Tuple<int, int>>));
+    CHECK_FALSE((arithmetic_scope::HasMinusAssign<ltpl::Tuple<const int>, ltpl::Tuple<int>>));
+    CHECK_FALSE((arithmetic_scope::HasMinusAssign<ltpl::Tuple<int*>, ltpl::Tuple<int*>>));
+}
+
+void test_arithmetic_min_max()
+{
+    using namespace ltpl::arithmetic;
+    const ltpl::Tuple<int, double> lhs{1, 4.};
+    const ltpl::Tuple<int, double> rhs{2, 3.};
+    CHECK_EQ((ltpl::Tuple{1, 3.}), ltpl::arithmetic::min(lhs, rhs));
+    CHECK_EQ((ltpl::Tuple{2, 4.}), ltpl::arithmetic::max(lhs, rhs));
+}
+
+void test_arithmetic_homogeneous_tuple()
+{
+    using namespace ltpl::arithmetic;
+    ltpl::HomogeneousTuple<float, 4> lhs{1.f, 2.f, 3.f, 4.f};
+    const ltpl::HomogeneousTuple<float, 4> rhs{4.f, 3.f, 2.f, 1.f};
+    CHECK_EQ((ltpl::HomogeneousTuple<float, 4>{5.f, 5.f, 5.f, 5.f}), lhs + rhs);
+    CHECK_EQ((ltpl::HomogeneousTuple<float, 4>{-3.f, -1.f, 1.f, 3.f}), lhs - rhs);
+    CHECK_EQ((ltpl::HomogeneousTuple<float, 4>{4.f, 6.f, 6.f, 4.f}), lhs * rhs);
+    CHECK_EQ((ltpl::HomogeneousTuple<float, 4>{1.f, 2.f, 2.f, 1.f}), ltpl::arithmetic::min(lhs, rhs));
+    CHECK_EQ((ltpl::HomogeneousTuple<float, 4>{4.f, 3.f, 3.f, 4.f}), ltpl::arithmetic::max(lhs, rhs));
+    lhs /= rhs;
+    CHECK_EQ((ltpl::HomogeneousTuple<float, 4>{.25f, 2.f / 3.f, 1.5f, 4.f}), lhs);
+    static_assert(ltpl::get<2>(ltpl::HomogeneousTuple<int, 3>{1, 2, 3} + ltpl::HomogeneousTuple<int, 3>{3, 2, 1}) == 4);
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_ARITHMETIC_HPP
@@ -0,0 +1,146 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_ARROW_HPP
+#define LTPL_TEST_TEST_ARROW_HPP
+
+#include <ltpl/arrow.hpp>
+#include <ltpl/tuple.hpp>
+#include <test/framework.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace test
+{
+void test_arrow_round_trip()
+{
+    using Columns = ltpl::Tuple<std::vector<std::int32_t>, std::vector<double>, std::vector<bool>,
+                                std::vector<std::string>, std::vector<std::uint8_t>>;
+    Columns columns{std::vector<std::int32_t>{1, -2, 3, 4, 5, 6, 7, 8, 9},
+                    std::vector<double>{.5, -1., 2., 3., 4., 5., 6., 7., 8.},
+                    std::vector<bool>{true, false, true, true, false, false, true, false, true},
+                    std::vector<std::string>{"a", "", "ccc", "d", "e", "f", "g", "h", std::string(100, 'i')},
+                    std::vector<std::uint8_t>{0, 1, 2, 3, 4, 5, 6, 7, 255}};
+    const auto expected = columns;
+    const auto* int_data = ltpl::get<0>(columns).data();
+    const auto* double_data = ltpl::get<1>(columns).data();
+    ArrowSchema schema;
+    ArrowArray array;
+    const std::string_view names[]{"id", "score", "active", "name", "flags"};
+    CHECK(ltpl::export_to_arrow(std::move(columns), &schema, &array, names));
+    CHECK_EQ(std::string_view{"+s"}, schema.format);
+    CHECK_EQ(5, schema.n_children);
+    CHECK_EQ(std::string_view{"score"}, schema.children[1]->name);
+    CHECK_EQ(9, array.length);
+    CHECK_EQ(int_data, array.children[0]->buffers[1]);
+    CHECK_EQ(double_data, array.children[1]->buffers[1]);
+    const auto imported =
+        ltpl::import_from_arrow<std::int32_t, double, bool, std::string, std::uint8_t>(&schema, &array);
+    CHECK(imported);
+    CHECK(expected == *imported);
+    CHECK_EQ(nullptr, schema.release);
+    CHECK_EQ(nullptr, array.release);
+}
+
+// Reads the exported structs through their C fields only, like a consumer written in C would.
+std::int64_t sum_int64_column(ArrowSchema* schema, ArrowArray* array, const char* name)
+{
+    std::int64_t sum{};
+    for (int64_t i = 0; i < schema->n_children; ++i)
+    {
+        if (std::strcmp(schema->children[i]->name, name) == 0 && std::strcmp(schema->children[i]->format, "l") == 0)
+        {
+            const ArrowArray* child = array->children[i];
+            const auto* values = static_cast<const int64_t*>(child->buffers[1]);
+            for (int64_t j = array->offset + child->offset; j < array->offset + array->length; ++j)
+            {
+                sum += values[j];
+            }
+        }
+    }
+    return sum;
+}
+
+void test_arrow_consumer()
+{
+    ltpl::Tuple<std::vector<std::string>, std::vector<std::int64_t>> columns{std::vector<std::string>{"x", "y", "z"},
+                                                                             std::vector<std::int64_t>{10, 20, 30}};
+    ArrowSchema schema;
+    ArrowArray array;
+    CHECK(ltpl::export_to_arrow(std::move(columns), &schema, &array));
+    CHECK_EQ(std::string_view{"u"}, schema.children[0]->format);
+    CHECK_EQ(std::string_view{"f1"}, schema.children[1]->name);
+    CHECK_EQ(60, sum_int64_column(&schema, &array, "f1"));
+    array.offset = 1;
+    array.length = 2;
+    CHECK_EQ(50, sum_int64_column(&schema, &array, "f1"));
+
+    // Move a child out, release the parent and keep using the child.
+    ArrowArray child = *array.children[0];
+    array.children[0]->release = nullptr;
+    array.release(&array);
+    schema.release(&schema);
+    CHECK_EQ(nullptr, array.release);
+    const auto* offsets = static_cast<const std::int32_t*>(child.buffers[1]);
+    const auto* data = static_cast<const char*>(child.buffers[2]);
+    CHECK_EQ(3, child.length);
+    CHECK_EQ("z", std::string_view(data + offsets[2], static_cast<std::size_t>(offsets[3] - offsets[2])));
+    child.release(&child);
+    CHECK_EQ(nullptr, child.release);
+}
+
+void test_arrow_import_mismatch()
+{
+    using Columns = ltpl::Tuple<std::vector<std::int16_t>, std::vector<std::string>>;
+    using Shorts = std::vector<std::int16_t>;
+    using Strings = std::vector<std::string>;
+    Columns columns{Shorts{1, 2, 3}, Strings{"a", "b"}};
+    ArrowSchema schema;
+    ArrowArray array;
+    const std::string_view names[]{"one"};
+    CHECK_FALSE(ltpl::export_to_arrow(std::move(columns), &schema, &array, names));
+    CHECK_FALSE(ltpl::export_to_arrow(std::move(columns), &schema, &array));
+    CHECK_EQ(3, ltpl::get<0>(columns).size());
+    ltpl::get<1>(columns).emplace_back("c");
+    CHECK(ltpl::export_to_arrow(std::move(columns), &schema, &array));
+    CHECK_FALSE((ltpl::import_from_arrow<std::uint16_t, std::string>(&schema, &array)));
+    CHECK_EQ(nullptr, schema.release);
+    CHECK_EQ(nullptr, array.release);
+
+    CHECK(ltpl::export_to_arrow(Columns{Shorts{1, 2, 3}, Strings{"a", "b", "c"}}, &schema, &array));
+    array.offset = 1;
+    array.length = 2;
+    const auto imported = ltpl::import_from_arrow<std::int16_t, std::string>(&schema, &array);
+    CHECK(imported);
+    CHECK((*imported == Columns{Shorts{2, 3}, Strings{"b", "c"}}));
+
+    // Dictionary-encoded children have the format of their indices.
+    ArrowSchema dictionary_schema{};
+    dictionary_schema.format = "u";
+    ArrowArray dictionary_array{};
+    CHECK(ltpl::export_to_arrow(ltpl::Tuple<std::vector<std::int32_t>>{std::vector<std::int32_t>{0, 1, 0}}, &schema,
+                                &array));
+    schema.children[0]->dictionary = &dictionary_schema;
+    CHECK_FALSE(ltpl::import_from_arrow<std::int32_t>(&schema, &array));
+    CHECK(ltpl::export_to_arrow(ltpl::Tuple<std::vector<std::int32_t>>{std::vector<std::int32_t>{0, 1, 0}}, &schema,
+                                &array));
+    array.children[0]->dictionary = &dictionary_array;
+    CHECK_FALSE(ltpl::import_from_arrow<std::int32_t>(&schema, &array));
+
+    ltpl::Tuple<std::vector<float>> empty;
+    CHECK(ltpl::export_to_arrow(std::move(empty), &schema, &array));
+    CHECK_EQ(std::string_view{"f"}, schema.children[0]->format);
+    const auto imported_empty = ltpl::import_from_arrow<float>(&schema, &array);
+    CHECK(imported_empty);
+    CHECK(ltpl::get<0>(*imported_empty).empty());
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_ARROW_HPP
@@ -0,0 +1,113 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_CAT_VIEW_HPP
+#define LTPL_TEST_TEST_CAT_VIEW_HPP
+
+#include <ltpl/cat_view.hpp>
+#include <ltpl/select.hpp>
+#include <ltpl/tuple.hpp>
+#include <test/framework.hpp>
+#include <test/utility.hpp>
+
+#include <string>
+
+namespace test
+{
+void test_cat_view()
+{
+    ltpl::Tuple<int, std::string> tuple{1, "a"};
+    const ltpl::Tuple<double> const_tuple{2.};
+    auto view = ltpl::cat_view(tuple, ltpl::Tuple<>{}, const_tuple);
+    CHECK_EQ(3, std::tuple_size_v<decltype(view)>);
+    CHECK(std::is_same_v<std::string&, std::tuple_element_t<1, decltype(view)>>);
+    CHECK(std::is_same_v<const double&, std::tuple_element_t<2, decltype(view)>>);
+    CHECK_EQ(&ltpl::get<1>(tuple), &ltpl::get<1>(view));
+    ltpl::get<0>(view) = 42;
+    CHECK_EQ(42, ltpl::get<0>(tuple));
+    auto& [i, s, d] = view;
+    CHECK_EQ(42, i);
+    CHECK_EQ("a", s);
+    CHECK_EQ(2., d);
+    CHECK_EQ(view, (ltpl::Tuple<int, std::string, double>{42, "a", 2.}));
+    CHECK_EQ((ltpl::Tuple<long, std::string, float>{42, "a", 2.f}), view);
+    CHECK_NE(view, (ltpl::Tuple<int, std::string, double>{42, "b", 2.}));
+    CHECK_EQ(view, ltpl::cat_view(ltpl::Tuple<int>{42}, ltpl::Tuple<std::string, double>{"a", 2.}));
+}
+
+void test_cat_view_rvalue()
+{
+    MoveOnly move_only{1};
+    ltpl::Tuple<MoveOnly> tuple{MoveOnly{2}};
+    // Rvalue sources are moved into the view, the objects that their reference elements refer to are not.
+    auto forwarded = ltpl::forward_as_tuple(std::move(move_only));
+    auto view = ltpl::cat_view(std::move(forwarded), std::move(tuple));
+    CHECK(ltpl::get<0>(tuple).is_moved_from);
+    CHECK_FALSE(move_only.is_moved_from);
+    CHECK(std::is_same_v<MoveOnly&&, std::tuple_element_t<0, decltype(view)>>);
+    CHECK(std::is_same_v<MoveOnly, std::tuple_element_t<1, decltype(view)>>);
+    CHECK(std::is_same_v<MoveOnly&, decltype(ltpl::get<1>(view))>);
+    CHECK(std::is_same_v<const MoveOnly&, decltype(ltpl::get<1>(std::as_const(view)))>);
+    MoveOnly first{ltpl::get<0>(std::move(view))};
+    MoveOnly second{ltpl::get<1>(std::move(view))};
+    CHECK(move_only.is_moved_from);
+    CHECK_EQ(2, second.v);
+    CHECK(ltpl::get<1>(view).is_moved_from);
+}
+
+auto make_cat_view(const ltpl::Tuple<int>& tuple)
+{
+    return ltpl::cat_view(tuple, ltpl::Tuple<std::string>{"a string that does not fit into the small buffer"});
+}
+
+void test_cat_view_owning()
+{
+    const ltpl::Tuple<int> tuple{1};
+    const auto view = test::make_cat_view(tuple);
+    CHECK_EQ(&ltpl::get<0>(tuple), &ltpl::get<0>(view));
+    CHECK_EQ("a string that does not fit into the small buffer", ltpl::get<1>(view));
+    const auto copy = view;
+    CHECK_EQ(view, copy);
+    CHECK_NE(&ltpl::get<1>(view), &ltpl::get<1>(copy));
+}
+
+void test_apply()
+{
+    ltpl::Tuple<int, std::string> tuple{1, "a"};
+    const auto size = ltpl::apply(
+        [](int& i, std::string& s)
+        {
+            return i + s.size();
+        },
+        tuple);
+    CHECK_EQ(2u, size);
+    ltpl::apply(
+        [](const int&, const std::string&) {}, std::as_const(tuple));
+    ltpl::apply(
+        [](int&&, std::string&& s)
+        {
+            std::string other{std::move(s)};
+        },
+        std::move(tuple));
+    CHECK(ltpl::get<1>(tuple).empty());
+    ltpl::Tuple<double> other{2.};
+    const auto sum = ltpl::apply(
+        [](auto... v)
+        {
+            return (0. + ... + v);
+        },
+        ltpl::cat_view(ltpl::select<0>(tuple), other, other));
+    CHECK_EQ(5., sum);
+    static constexpr ltpl::Tuple<int, int> constant{1, 2};
+    static_assert(3 == ltpl::apply(
+                           [](int a, int b)
+                           {
+                               return a + b;
+                           },
+                           constant));
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_CAT_VIEW_HPP
@@ -0,0 +1,140 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_COMPACT_ENCODING_HPP
+#define LTPL_TEST_TEST_COMPACT_ENCODING_HPP
+
+#include <ltpl/compact_encoding.hpp>
+#include <ltpl/tuple.hpp>
+#include <test/framework.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace test
+{
+enum class Color : std::uint8_t
+{
+    RED,
+    GREEN = 200
+};
+
+enum class Flag : bool
+{
+    OFF,
+    ON
+};
+
+template <class... T>
+std::vector<std::byte> compact_bytes(const ltpl::Tuple<T...>& tuple)
+{
+    std::vector<std::byte> buffer;
+    ltpl::compact_encode(tuple, buffer);
+    return buffer;
+}
+
+template <class... T>
+std::vector<std::byte> bytes_of(T... b)
+{
+    return {static_cast<std::byte>(b)...};
+}
+
+template <class T>
+concept CompactDecodable = requires(std::span<const std::byte>& input) { ltpl::compact_decode<T>(input); };
+
+void test_compact_encode()
+{
+    CHECK((compact_bytes(ltpl::Tuple<std::uint32_t, int, int, bool>{300, -1, 1, true}) ==
+           bytes_of(0xAC, 0x02, 0x01, 0x02, 0x01)));
+    CHECK((compact_bytes(ltpl::Tuple<std::string_view, float>{"ab", 1.f}) ==
+           bytes_of(0x02, 'a', 'b', 0x00, 0x00, 0x80, 0x3F)));
+    CHECK((compact_bytes(ltpl::Tuple<std::int64_t>{std::numeric_limits<std::int64_t>::min()}) ==
+           bytes_of(0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01)));
+    static_assert(ltpl::compact_max_size_v<ltpl::Tuple<std::uint8_t, std::int32_t, std::uint64_t, bool, double>> ==
+                  2 + 5 + 10 + 1 + 8);
+    static_assert(ltpl::compact_max_size_v<ltpl::Tuple<ltpl::Tuple<Color>, std::int16_t>> == 2 + 3);
+    CHECK(CompactDecodable<ltpl::Tuple<int, std::string>>);
+    CHECK_FALSE(CompactDecodable<ltpl::Tuple<std::string_view>>);
+    CHECK_FALSE(CompactDecodable<ltpl::Tuple<const int&>>);
+}
+
+void test_compact_decode()
+{
+    using Row = ltpl::Tuple<std::int64_t, std::uint16_t, std::string, double, Color, ltpl::Tuple<bool, std::int8_t>>;
+    const std::vector<Row> rows{
+        {0, 0, "", 0., Color::RED, ltpl::Tuple<bool, std::int8_t>{false, 0}},
+        {std::numeric_limits<std::int64_t>::min(), 65535, "text", -2.5, Color::GREEN,
+         ltpl::Tuple<bool, std::int8_t>{true, -128}},
+        {std::numeric_limits<std::int64_t>::max(), 128, std::string(300, 'x'), 1e300, Color::GREEN,
+         ltpl::Tuple<bool, std::int8_t>{true, 127}}};
+    std::vector<std::byte> buffer;
+    for (const auto& row : rows)
+    {
+        ltpl::compact_encode(row, buffer);
+    }
+    std::span<const std::byte> input{buffer};
+    for (const auto& row : rows)
+    {
+        CHECK(ltpl::compact_decode<Row>(input) == row);
+    }
+    CHECK(input.empty());
+    const auto second = compact_bytes(rows[1]);
+    for (std::size_t size{}; size != second.size(); ++size)
+    {
+        std::span<const std::byte> truncated{second.data(), size};
+        CHECK_FALSE(ltpl::compact_decode<Row>(truncated).has_value());
+        CHECK_EQ(size, truncated.size());
+    }
+    const auto too_large = bytes_of(0xAC, 0x02);
+    std::span<const std::byte> too_large_input{too_large};
+    CHECK_FALSE(ltpl::compact_decode<ltpl::Tuple<std::uint8_t>>(too_large_input).has_value());
+    CHECK_EQ(2, too_large_input.size());
+    const auto not_bool = bytes_of(0x02);
+    std::span<const std::byte> not_bool_input{not_bool};
+    CHECK_FALSE(ltpl::compact_decode<ltpl::Tuple<bool>>(not_bool_input).has_value());
+}
+
+void test_compact_decode_small_integers()
+{
+    using Row = ltpl::Tuple<int, std::uint64_t, bool, Color, std::int8_t>;
+    const Row small{-3, 100, true, Color::RED, 63};
+    const Row large{-3, 1000, true, Color::GREEN, -64};
+    std::vector<std::byte> buffer;
+    ltpl::compact_encode(small, buffer);
+    CHECK_EQ(5, buffer.size());
+    ltpl::compact_encode(large, buffer);
+    std::span<const std::byte> input{buffer};
+    CHECK(ltpl::compact_decode<Row>(input) == small);
+    CHECK(ltpl::compact_decode<Row>(input) == large);
+    CHECK(input.empty());
+    const auto not_bool = bytes_of(0x00, 0x00, 0x02, 0x00, 0x00);
+    std::span<const std::byte> not_bool_input{not_bool};
+    CHECK_FALSE(ltpl::compact_decode<Row>(not_bool_input).has_value());
+}
+
+void test_compact_encoding_bool_enum()
+{
+    using Row = ltpl::Tuple<Flag, int>;
+    static_assert(ltpl::compact_max_size_v<Row> == 1 + ltpl::compact_max_size_v<ltpl::Tuple<int>>);
+    std::vector<std::byte> buffer;
+    ltpl::compact_encode(Row{Flag::ON, 300}, buffer);
+    ltpl::compact_encode(Row{Flag::OFF, -1}, buffer);
+    CHECK((buffer == bytes_of(0x01, 0xD8, 0x04, 0x00, 0x01)));
+    std::span<const std::byte> input{buffer};
+    CHECK((ltpl::compact_decode<Row>(input) == Row{Flag::ON, 300}));
+    CHECK((ltpl::compact_decode<Row>(input) == Row{Flag::OFF, -1}));
+    CHECK(input.empty());
+    const auto not_bool = bytes_of(0x02, 0x00);
+    std::span<const std::byte> not_bool_input{not_bool};
+    CHECK_FALSE(ltpl::compact_decode<Row>(not_bool_input).has_value());
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_COMPACT_ENCODING_HPP
@@ -11,6 +11,10 @@
 #include <test/framework.hpp>
 #include <test/utility.hpp>
 
+#include <compare>
+#include <string>
+#include <type_traits>
+
 namespace test
 {
 template <class T>
@@ -74,6 +78,50 @@ void test_equality_compare_value_rref()
     CHECK_EQ(tuple3, tuple);
 }
 
+template <class T, class U>
+concept ThreeWayComparableWith = requires(const T& t, const U& u) { t <=> u; };
+
+struct OnlyLess
+{
+    int value;
+
+    friend bool operator<(const OnlyLess& lhs, const OnlyLess& rhs) { return lhs.value < rhs.value; }
+};
+
+template <class T>
+void test_three_way_compare()
+{
+    TupleT<T, int, std::string> tuple(1, "b");
+    TupleT<T, int, std::string> tuple2(1, "c");
+    TupleT<T, long, std::string> tuple3(0, "z");
+    CHECK(tuple < tuple2);
+    CHECK(tuple2 > tuple);
+    CHECK(tuple <= tuple);
+    CHECK_FALSE(tuple < tuple);
+    CHECK(tuple3 < tuple);
+    CHECK(tuple >= tuple3);
+    CHECK((std::is_same_v<std::strong_ordering, decltype(TupleT<T, int, long>() <=> TupleT<T, int, long>())>));
+    CHECK((std::is_same_v<std::partial_ordering, decltype(TupleT<T, int, double>() <=> TupleT<T, int, double>())>));
+    TupleT<T, int, OnlyLess> only_less(1, OnlyLess{1});
+    TupleT<T, int, OnlyLess> only_less2(1, OnlyLess{2});
+    CHECK((std::is_same_v<std::weak_ordering, decltype(only_less <=> only_less2)>));
+    CHECK(only_less < only_less2);
+    CHECK_EQ(std::weak_ordering::equivalent, only_less <=> only_less);
+    CHECK_EQ(std::strong_ordering::equal, TupleT<T>() <=> TupleT<T>());
+}
+
+void test_three_way_compare_reference()
+{
+    int i{1};
+    const std::string s{"a"};
+    ltpl::Tuple<int&, const std::string&> tuple{i, s};
+    CHECK(tuple < ltpl::Tuple<int, std::string>(1, "b"));
+    CHECK(ltpl::Tuple<long, std::string>(0, "b") < tuple);
+    CHECK((ThreeWayComparableWith<ltpl::Tuple<int>, ltpl::Tuple<long>>));
+    CHECK_FALSE((ThreeWayComparableWith<ltpl::Tuple<int>, ltpl::Tuple<const char*>>));
+    CHECK_FALSE((ThreeWayComparableWith<ltpl::Tuple<int>, ltpl::Tuple<int, int>>));
+}
+
 void test_not_equality_comparable()
 {
     CHECK_FALSE(WeaklyEqualityComparableWith<ltpl::Tuple<>, ltpl::Tuple<const char*>>);
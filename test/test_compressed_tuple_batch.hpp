@@ -0,0 +1,119 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_COMPRESSED_TUPLE_BATCH_HPP
+#define LTPL_TEST_TEST_COMPRESSED_TUPLE_BATCH_HPP
+
+#include <ltpl/compressed_tuple_batch.hpp>
+#include <ltpl/tuple.hpp>
+#include <test/framework.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace test
+{
+template <class T>
+std::vector<T> decode_column(const ltpl::CompressedColumn<T>& column)
+{
+    std::vector<T> values;
+    for (const auto& value : column)
+    {
+        values.push_back(value);
+    }
+    return values;
+}
+
+void test_compressed_tuple_batch()
+{
+    using Row = ltpl::Tuple<std::int64_t, std::string, std::int32_t, double, bool, std::uint8_t>;
+    const std::string regions[]{"eu-central", "us-east", "ap-south"};
+    std::vector<Row> rows;
+    std::size_t uncompressed_size{};
+    for (std::int64_t i{}; i != 1000; ++i)
+    {
+        rows.emplace_back(1'650'000'000'000 + i * 1000 + (i % 3), regions[i % 3], static_cast<std::int32_t>(i / 100),
+                          static_cast<double>(i % 10) / 4, i % 2 == 0, static_cast<std::uint8_t>(i % 7));
+        uncompressed_size += sizeof(Row) + ltpl::get<1>(rows.back()).size();
+    }
+    const ltpl::CompressedTupleBatch<std::int64_t, std::string, std::int32_t, double, bool, std::uint8_t> batch{
+        std::span<const Row>{rows}};
+    CHECK_EQ(rows.size(), batch.size());
+    CHECK_FALSE(batch.empty());
+    CHECK(ltpl::ColumnEncoding::DELTA_OF_DELTA == batch.column<0>().encoding());
+    CHECK_EQ(3, batch.column<1>().dictionary().size());
+    CHECK(ltpl::ColumnEncoding::RUN_LENGTH == batch.column<2>().encoding());
+    CHECK(ltpl::ColumnEncoding::BIT_PACKED == batch.column<5>().encoding());
+    CHECK_EQ((1000 + 63) / 64 * 8, batch.column<4>().size_bytes());
+    CHECK(batch.size_bytes() * 5 < uncompressed_size);
+    std::size_t i{};
+    bool equal = true;
+    for (const auto& row : batch)
+    {
+        equal = equal && row == rows[i] && batch[i] == rows[i];
+        ++i;
+    }
+    CHECK(equal);
+    CHECK_EQ(rows.size(), i);
+    std::int64_t sum{};
+    for (const auto value : batch.column<2>())
+    {
+        sum += value;
+    }
+    CHECK_EQ(4500, sum);
+    CHECK_EQ("us-east", batch.column<1>()[1]);
+}
+
+void test_compressed_column()
+{
+    constexpr auto MIN = std::numeric_limits<std::int64_t>::min();
+    constexpr auto MAX = std::numeric_limits<std::int64_t>::max();
+    const std::vector<std::int64_t> extremes{MIN, MAX, 0, -1, MAX, MIN, 1};
+    const ltpl::CompressedColumn<std::int64_t> extreme_column{std::span{extremes}};
+    CHECK(ltpl::ColumnEncoding::BIT_PACKED == extreme_column.encoding());
+    CHECK_EQ(extremes.size() * 8, extreme_column.size_bytes());
+    CHECK((test::decode_column(extreme_column) == extremes));
+
+    std::vector<std::uint64_t> descending;
+    for (std::uint64_t i{}; i != 1000; ++i)
+    {
+        descending.push_back(std::numeric_limits<std::uint64_t>::max() - i * i);
+    }
+    const ltpl::CompressedColumn<std::uint64_t> descending_column{std::span{descending}};
+    CHECK(ltpl::ColumnEncoding::DELTA_OF_DELTA == descending_column.encoding());
+    bool equal = true;
+    for (const auto i : {0, 1, 127, 128, 129, 255, 256, 999})
+    {
+        equal = equal && descending_column[static_cast<std::size_t>(i)] == descending[static_cast<std::size_t>(i)];
+    }
+    CHECK(equal);
+    CHECK((test::decode_column(descending_column) == descending));
+
+    const std::vector<float> floats{1.5f, -0.f, 1.5f, 1e30f};
+    const ltpl::CompressedColumn<float> float_column{std::span{floats}};
+    CHECK((test::decode_column(float_column) == floats));
+
+    const ltpl::CompressedColumn<std::string> empty_column{std::span<const std::string>{}};
+    CHECK(empty_column.empty());
+    CHECK(empty_column.begin() == empty_column.end());
+
+    using Columns = ltpl::Tuple<std::vector<bool>, std::vector<std::string>>;
+    const Columns columns{std::vector<bool>(300, true), std::vector<std::string>(300, "same")};
+    const auto batch = ltpl::CompressedTupleBatch<bool, std::string>::from_columns(columns);
+    CHECK(batch.has_value());
+    CHECK_EQ(300, batch->size());
+    CHECK(ltpl::ColumnEncoding::BIT_PACKED == batch->column<0>().encoding());
+    CHECK_EQ(0, batch->column<0>().size_bytes());
+    CHECK(((*batch)[299] == ltpl::Tuple<bool, std::string>{true, "same"}));
+    const Columns mismatched{std::vector<bool>(300, true), std::vector<std::string>(299, "same")};
+    CHECK_FALSE(ltpl::CompressedTupleBatch<bool, std::string>::from_columns(mismatched).has_value());
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_COMPRESSED_TUPLE_BATCH_HPP
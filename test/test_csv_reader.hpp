@@ -0,0 +1,140 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_CSV_READER_HPP
+#define LTPL_TEST_TEST_CSV_READER_HPP
+
+#include <ltpl/csv_reader.hpp>
+#include <ltpl/tuple.hpp>
+#include <test/framework.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace test
+{
+void test_csv_reader()
+{
+    std::istringstream input{"id,name,score,active\n"
+                             "1,alice,25,true\r\n"
+                             "\n"
+                             "-2,\"bob, \"\"the builder\"\"\",-125,0\n"
+                             "3,\"multi\nline\",1000,1"};
+    ltpl::CsvReader<std::int64_t, std::string, int, bool> reader{input, {.has_header = true}};
+    ltpl::Tuple<std::int64_t, std::string, int, bool> row;
+    CHECK(ltpl::CsvResult::ROW == reader.read(row));
+    CHECK((row == ltpl::Tuple<std::int64_t, std::string, int, bool>{1, "alice", 25, true}));
+    CHECK_EQ(2, reader.record_number());
+    CHECK(ltpl::CsvResult::ROW == reader.read(row));
+    CHECK((row == ltpl::Tuple<std::int64_t, std::string, int, bool>{-2, "bob, \"the builder\"", -125, false}));
+    CHECK(ltpl::CsvResult::ROW == reader.read(row));
+    CHECK((row == ltpl::Tuple<std::int64_t, std::string, int, bool>{3, "multi\nline", 1000, true}));
+    CHECK(ltpl::CsvResult::END_OF_INPUT == reader.read(row));
+    CHECK(ltpl::CsvResult::END_OF_INPUT == reader.read(row));
+}
+
+// Floating-point fields require `std::from_chars` for floating-point types, which not every standard library provides.
+// The template parameter keeps the discarded branch from being instantiated.
+template <class Double = double>
+void test_csv_reader_floating_point()
+{
+    if constexpr (ltpl::detail::HAS_FLOATING_POINT_FROM_CHARS)
+    {
+        std::istringstream input{"2.5,x\n-0.125,y\n1e3,z\n"};
+        ltpl::CsvReader<Double, std::string> reader{input};
+        ltpl::Tuple<Double, std::string> row;
+        CHECK(ltpl::CsvResult::ROW == reader.read(row));
+        CHECK((row == ltpl::Tuple<Double, std::string>{2.5, "x"}));
+        CHECK(ltpl::CsvResult::ROW == reader.read(row));
+        CHECK((row == ltpl::Tuple<Double, std::string>{-0.125, "y"}));
+        CHECK(ltpl::CsvResult::ROW == reader.read(row));
+        CHECK((row == ltpl::Tuple<Double, std::string>{1000., "z"}));
+        CHECK(ltpl::CsvResult::END_OF_INPUT == reader.read(row));
+    }
+}
+
+void test_csv_reader_invalid_rows()
+{
+    std::istringstream input{"1,2\n"
+                             "1\n"
+                             "1,2,3\n"
+                             "x,2\n"
+                             "1,2 \n"
+                             "300,2\n"
+                             "\"1,2\n"
+                             "3,4\n"};
+    ltpl::CsvReader<std::uint8_t, int> reader{input};
+    ltpl::Tuple<std::uint8_t, int> row;
+    CHECK(ltpl::CsvResult::ROW == reader.read(row));
+    CHECK(ltpl::CsvResult::INVALID_ROW == reader.read(row));
+    CHECK(ltpl::CsvResult::INVALID_ROW == reader.read(row));
+    CHECK(ltpl::CsvResult::INVALID_ROW == reader.read(row));
+    CHECK(ltpl::CsvResult::INVALID_ROW == reader.read(row));
+    CHECK(ltpl::CsvResult::INVALID_ROW == reader.read(row));
+    CHECK_EQ(6, reader.record_number());
+    CHECK(ltpl::CsvResult::INVALID_ROW == reader.read(row));
+    CHECK(ltpl::CsvResult::END_OF_INPUT == reader.read(row));
+}
+
+void test_csv_reader_quote_inside_unquoted_field()
+{
+    std::istringstream input{"1,ab\"c\n"
+                             "2,x\n"
+                             "3,\"y\"\"\n\"\"\"\n"
+                             "4,5'10\"\n"
+                             "5,\"z\"\n"};
+    ltpl::CsvReader<int, std::string> reader{input, {.buffer_size = 4}};
+    ltpl::Tuple<int, std::string> row;
+    CHECK(ltpl::CsvResult::ROW == reader.read(row));
+    CHECK((row == ltpl::Tuple<int, std::string>{1, "ab\"c"}));
+    CHECK(ltpl::CsvResult::ROW == reader.read(row));
+    CHECK((row == ltpl::Tuple<int, std::string>{2, "x"}));
+    CHECK(ltpl::CsvResult::ROW == reader.read(row));
+    CHECK((row == ltpl::Tuple<int, std::string>{3, "y\"\n\""}));
+    CHECK(ltpl::CsvResult::ROW == reader.read(row));
+    CHECK((row == ltpl::Tuple<int, std::string>{4, "5'10\""}));
+    CHECK(ltpl::CsvResult::ROW == reader.read(row));
+    CHECK((row == ltpl::Tuple<int, std::string>{5, "z"}));
+    CHECK(ltpl::CsvResult::END_OF_INPUT == reader.read(row));
+}
+
+void test_csv_reader_string_view_and_small_buffer()
+{
+    std::string text;
+    for (int i{}; i != 100; ++i)
+    {
+        text += std::to_string(i) + "\t" + std::string(static_cast<std::size_t>(i % 23), 'a') + "\n";
+    }
+    std::istringstream input{text};
+    ltpl::CsvReader<int, std::string_view> reader{input, {.delimiter = '\t', .buffer_size = 4}};
+    ltpl::Tuple<int, std::string_view> row;
+    int count{};
+    while (reader.read(row) == ltpl::CsvResult::ROW)
+    {
+        CHECK_EQ(count, ltpl::get<0>(row));
+        CHECK_EQ(std::string(static_cast<std::size_t>(count % 23), 'a'), ltpl::get<1>(row));
+        ++count;
+    }
+    CHECK_EQ(100, count);
+}
+
+void test_csv_reader_columns()
+{
+    std::istringstream input{"1,a\n2,b\n3,c\n4,d\n5,e\n"};
+    ltpl::CsvReader<int, std::string> reader{input};
+    ltpl::Tuple<std::vector<int>, std::vector<std::string>> columns;
+    CHECK(ltpl::CsvResult::ROW == reader.read_columns(columns, 3));
+    CHECK((ltpl::get<0>(columns) == std::vector{1, 2, 3}));
+    CHECK(ltpl::CsvResult::END_OF_INPUT == reader.read_columns(columns, 3));
+    CHECK((ltpl::get<0>(columns) == std::vector{1, 2, 3, 4, 5}));
+    CHECK((ltpl::get<1>(columns) == std::vector<std::string>{"a", "b", "c", "d", "e"}));
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_CSV_READER_HPP
@@ -0,0 +1,100 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_FLAT_TUPLE_MAP_HPP
+#define LTPL_TEST_TEST_FLAT_TUPLE_MAP_HPP
+
+#include <ltpl/flat_tuple_map.hpp>
+#include <ltpl/tuple.hpp>
+#include <test/framework.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+namespace test
+{
+template <class Map, class Key>
+concept CanFind = requires(Map& map, const Key& key) { map.find(key); };
+
+void test_flat_tuple_map()
+{
+    ltpl::FlatTupleMap<ltpl::Tuple<int, std::string>, int> map;
+    CHECK(map.empty());
+    CHECK(map.find(ltpl::Tuple<int, std::string>{1, "a"}) == map.end());
+    const auto [it, inserted] = map.try_emplace(ltpl::Tuple<int, std::string>{1, "a"}, 10);
+    CHECK(inserted);
+    CHECK_EQ(10, ltpl::get<1>(*it));
+    CHECK_FALSE(map.try_emplace(ltpl::Tuple<int, std::string>{1, "a"}, 20).second);
+    CHECK_EQ(1, map.size());
+    map[ltpl::Tuple<int, std::string>{2, "b"}] = 20;
+    CHECK_EQ(20, ltpl::get<1>(*map.find(ltpl::Tuple<int, std::string>{2, "b"})));
+    CHECK_EQ(1, map.erase(ltpl::Tuple<int, std::string>{1, "a"}));
+    CHECK_EQ(0, map.erase(ltpl::Tuple<int, std::string>{1, "a"}));
+    CHECK_FALSE(map.contains(ltpl::Tuple<int, std::string>{1, "a"}));
+    CHECK_EQ(1, map.size());
+}
+
+void test_flat_tuple_map_heterogeneous_lookup()
+{
+    ltpl::FlatTupleMap<ltpl::Tuple<int, std::string>, int> map;
+    const std::string key{"key"};
+    int i{1};
+    map.try_emplace(ltpl::forward_as_tuple(i, key), 42);
+    CHECK(map.contains(ltpl::Tuple<int, std::string>{1, "key"}));
+    CHECK(map.contains(ltpl::Tuple<const int&, const std::string&>{i, key}));
+    CHECK_EQ(42, ltpl::get<1>(*map.find(ltpl::forward_as_tuple(1, key))));
+    CHECK((CanFind<decltype(map), ltpl::Tuple<int&, std::string&&>>));
+    CHECK_FALSE((CanFind<decltype(map), ltpl::Tuple<int, const char*>>));
+    CHECK_FALSE((CanFind<decltype(map), ltpl::Tuple<int>>));
+}
+
+void test_flat_tuple_map_growth()
+{
+    ltpl::FlatTupleMap<ltpl::Tuple<int, int>, int> map;
+    constexpr int SIZE = 10000;
+    for (int i{}; i != SIZE; ++i)
+    {
+        map[ltpl::Tuple{i, -i}] = i;
+    }
+    CHECK_EQ(SIZE, map.size());
+    CHECK(map.capacity() - map.capacity() / 8 >= map.size());
+    for (int i{}; i != SIZE; i += 2)
+    {
+        map.erase(ltpl::Tuple{i, -i});
+    }
+    CHECK_EQ(SIZE / 2, map.size());
+    for (int i{}; i != SIZE; ++i)
+    {
+        const auto it = map.find(ltpl::forward_as_tuple(i, -i));
+        CHECK_EQ(i % 2 == 1, it != map.end());
+    }
+    for (int i{}; i != 2 * SIZE; ++i)
+    {
+        map.try_emplace(ltpl::Tuple{i + SIZE, 0}, i);
+        map.erase(ltpl::Tuple{i + SIZE, 0});
+    }
+    CHECK_EQ(SIZE / 2, map.size());
+    std::size_t count{};
+    long long sum{};
+    for (auto [key, value] : std::as_const(map))
+    {
+        ++count;
+        sum += value;
+        CHECK_EQ(-ltpl::get<0>(key), ltpl::get<1>(key));
+    }
+    CHECK_EQ(map.size(), count);
+    CHECK_EQ(static_cast<long long>(SIZE / 2) * (SIZE / 2), sum);
+    const auto copy = map;
+    CHECK_EQ(map.size(), copy.size());
+    CHECK(copy.contains(ltpl::Tuple{1, -1}));
+    auto moved = std::move(map);
+    CHECK(moved.contains(ltpl::Tuple{1, -1}));
+    moved.clear();
+    CHECK(moved.empty());
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_FLAT_TUPLE_MAP_HPP
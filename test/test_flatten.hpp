@@ -0,0 +1,65 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_FLATTEN_HPP
+#define LTPL_TEST_TEST_FLATTEN_HPP
+
+#include <ltpl/flatten.hpp>
+#include <ltpl/tuple.hpp>
+#include <test/framework.hpp>
+#include <test/utility.hpp>
+
+#include <string>
+
+namespace test
+{
+void test_flat_tuple_t()
+{
+    using Nested = ltpl::Tuple<ltpl::Tuple<int, char>, ltpl::Tuple<double, ltpl::Tuple<std::string, float>>>;
+    CHECK(std::is_same_v<ltpl::Tuple<int, char, double, std::string, float>, ltpl::flat_tuple_t<Nested>>);
+    CHECK(std::is_same_v<ltpl::Tuple<int, char, double>, ltpl::flat_tuple_t<ltpl::Tuple<int, char>, double>>);
+    CHECK(std::is_same_v<ltpl::Tuple<>, ltpl::flat_tuple_t<ltpl::Tuple<>, ltpl::Tuple<ltpl::Tuple<>>>>);
+    CHECK(std::is_same_v<ltpl::Tuple<int&, ltpl::Tuple<char>&>,
+                         ltpl::flat_tuple_t<ltpl::Tuple<int&>, ltpl::Tuple<ltpl::Tuple<char>&>>>);
+}
+
+void test_get_path()
+{
+    ltpl::Tuple<int, ltpl::Tuple<double, ltpl::Tuple<std::string, float>>> nested{
+        1, ltpl::Tuple<double, ltpl::Tuple<std::string, float>>{2., ltpl::Tuple<std::string, float>{"a", 3.f}}};
+    CHECK_EQ(1, ltpl::get_path<0>(nested));
+    CHECK_EQ("a", (ltpl::get_path<1, 1, 0>(nested)));
+    ltpl::get_path<1, 0>(nested) = 4.;
+    CHECK_EQ(4., ltpl::get<0>(ltpl::get<1>(nested)));
+    CHECK(std::is_same_v<const float&, decltype(ltpl::get_path<1, 1, 1>(std::as_const(nested)))>);
+    CHECK(std::is_same_v<std::string&&, decltype(ltpl::get_path<1, 1, 0>(std::move(nested)))>);
+    static constexpr ltpl::Tuple<ltpl::Tuple<int, int>> constant{ltpl::Tuple<int, int>{1, 2}};
+    static_assert(2 == ltpl::get_path<0, 1>(constant));
+}
+
+void test_flatten()
+{
+    using Inner = ltpl::Tuple<MoveOnly, ltpl::Tuple<std::string, int>>;
+    ltpl::Tuple<int, Inner> nested{1, Inner{MoveOnly{2}, ltpl::Tuple<std::string, int>{"a", 3}}};
+    auto flat = ltpl::flatten(std::move(nested));
+    CHECK(std::is_same_v<ltpl::Tuple<int, MoveOnly, std::string, int>, decltype(flat)>);
+    CHECK_EQ(2, ltpl::get<1>(flat).v);
+    CHECK_EQ("a", ltpl::get<2>(flat));
+    CHECK_EQ(3, ltpl::get<3>(flat));
+    CHECK((ltpl::get_path<1, 0>(nested).is_moved_from));
+
+    int i{4};
+    ltpl::Tuple<ltpl::Tuple<int&, std::string>, double> with_reference{ltpl::Tuple<int&, std::string>{i, "b"}, 5.};
+    auto flat_copy = ltpl::flatten(with_reference);
+    CHECK(std::is_same_v<ltpl::Tuple<int&, std::string, double>, decltype(flat_copy)>);
+    CHECK_EQ(&i, &ltpl::get<0>(flat_copy));
+    CHECK_EQ("b", (ltpl::get_path<0, 1>(with_reference)));
+    static constexpr ltpl::Tuple<ltpl::Tuple<int, int>, int> constant{ltpl::Tuple<int, int>{1, 2}, 3};
+    static constexpr auto flat_constant = ltpl::flatten(constant);
+    CHECK_EQ((ltpl::Tuple<int, int, int>{1, 2, 3}), flat_constant);
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_FLATTEN_HPP
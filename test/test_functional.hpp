@@ -0,0 +1,100 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_FUNCTIONAL_HPP
+#define LTPL_TEST_TEST_FUNCTIONAL_HPP
+
+#include <ltpl/functional.hpp>
+#include <ltpl/tuple.hpp>
+#include <test/framework.hpp>
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
+
+namespace test
+{
+void test_transparent_less()
+{
+    using Key = ltpl::Tuple<std::string, int>;
+    const std::set<Key, ltpl::transparent_less> set{Key{"a", 1}, Key{"b", 1}, Key{"b", 2}};
+    using namespace std::string_literals;
+    using namespace std::string_view_literals;
+    CHECK(set.contains(ltpl::Tuple<std::string_view, int>{"b"sv, 2}));
+    CHECK_FALSE(set.contains(ltpl::Tuple<std::string_view, int>{"c"sv, 2}));
+    const std::string b{"b"};
+    CHECK(set.contains(ltpl::Tuple<const std::string&, int>{b, 1}));
+    CHECK(set.contains(std::tuple{"a"sv, 1}));
+    CHECK(set.contains(std::pair{"a"s, 1}));
+    CHECK_EQ(2, set.count(ltpl::Tuple<std::string_view, int>{"b"sv, 2}) + set.count(std::tuple{"a"sv, 1}));
+    static_assert(ltpl::transparent_less{}(ltpl::Tuple{1, 2}, std::tuple{1, 3}));
+    static_assert(!ltpl::transparent_less{}(std::tuple{1, 3}, ltpl::Tuple{1, 2}));
+    CHECK_FALSE((std::is_invocable_v<ltpl::transparent_less, ltpl::Tuple<int>, std::tuple<int, int>>));
+    CHECK_FALSE((std::is_invocable_v<ltpl::transparent_less, ltpl::Tuple<int>, std::tuple<const char*>>));
+}
+
+void test_transparent_equal_and_hash()
+{
+    using Key = ltpl::Tuple<std::string, int>;
+    using namespace std::string_view_literals;
+    const ltpl::transparent_hash hash{};
+    const ltpl::transparent_equal equal{};
+    const std::string a{"a"};
+    CHECK_EQ(hash(Key{"a", 1}), hash(ltpl::Tuple<std::string_view, int>{"a"sv, 1}));
+    CHECK_EQ(hash(Key{"a", 1}), hash(ltpl::Tuple<const std::string&, int>{a, 1}));
+    CHECK_EQ(hash(Key{"a", 1}), hash(std::tuple{"a", 1}));
+    CHECK(hash(Key{"a", 1}) != hash(Key{"a", 2}));
+    CHECK(equal(Key{"a", 1}, std::tuple{"a"sv, 1}));
+    CHECK_FALSE(equal(Key{"a", 1}, std::tuple{"a"sv, 2}));
+    CHECK_FALSE((std::is_invocable_v<ltpl::transparent_equal, ltpl::Tuple<int>, std::tuple<int, int>>));
+#if __cpp_lib_generic_unordered_lookup >= 201811L
+    const std::unordered_set<Key, ltpl::transparent_hash, ltpl::transparent_equal> set{Key{"a", 1}, Key{"b", 2}};
+    CHECK(set.contains(ltpl::Tuple<std::string_view, int>{"b"sv, 2}));
+    CHECK(set.contains(ltpl::forward_as_tuple(a, 1)));
+    CHECK_FALSE(set.contains(std::tuple{"b"sv, 1}));
+#endif
+}
+
+void test_order_by()
+{
+    using Row = ltpl::Tuple<int, std::string, double, int>;
+    std::vector<Row> rows{{2, "b", 0.5, 1}, {1, "a", 1.5, 3}, {3, "c", 2.5, 1}, {0, "d", 3.5, 3}};
+    std::sort(rows.begin(), rows.end(), ltpl::order_by<ltpl::desc<3>, ltpl::asc<0>>{});
+    CHECK_EQ(0, ltpl::get<0>(rows[0]));
+    CHECK_EQ(1, ltpl::get<0>(rows[1]));
+    CHECK_EQ(2, ltpl::get<0>(rows[2]));
+    CHECK_EQ(3, ltpl::get<0>(rows[3]));
+    std::sort(rows.begin(), rows.end(), ltpl::less_by<1>{});
+    CHECK_EQ("a", ltpl::get<1>(rows[0]));
+    CHECK_EQ("d", ltpl::get<1>(rows[3]));
+    std::sort(rows.begin(), rows.end(), ltpl::greater_by<2>{});
+    CHECK_EQ(3.5, ltpl::get<2>(rows[0]));
+    CHECK_EQ(0.5, ltpl::get<2>(rows[3]));
+    static_assert(ltpl::less_by<1, 0>{}(ltpl::Tuple{2, 1}, ltpl::Tuple{1, 2}));
+    static_assert(!ltpl::less_by<1, 0>{}(ltpl::Tuple{1, 2}, ltpl::Tuple{1, 2}));
+    static_assert(ltpl::greater_by<0>{}(ltpl::Tuple{2, 1}, ltpl::Tuple{1, 2}));
+    const std::string a{"a"};
+    CHECK(ltpl::less_by<0>{}(ltpl::Tuple<const std::string&>{a}, ltpl::Tuple<std::string>{"b"}));
+    CHECK_FALSE((std::is_invocable_v<ltpl::less_by<1>, ltpl::Tuple<int>, ltpl::Tuple<int>>));
+    CHECK_FALSE((std::is_invocable_v<ltpl::less_by<0>, ltpl::Tuple<int>, ltpl::Tuple<std::string>>));
+}
+
+void test_equal_by()
+{
+    using namespace std::string_view_literals;
+    const ltpl::Tuple<int, std::string, double> lhs{1, "a", 0.5};
+    CHECK(ltpl::equal_by<1>{}(lhs, ltpl::Tuple{2, "a"sv}));
+    CHECK(ltpl::equal_by<0, 1>{}(lhs, ltpl::Tuple{1, "a"sv}));
+    CHECK_FALSE((ltpl::equal_by<0, 1>{}(lhs, ltpl::Tuple{2, "a"sv})));
+    static_assert(ltpl::equal_by<>{}(ltpl::Tuple{1}, ltpl::Tuple{2}));
+    CHECK_FALSE((std::is_invocable_v<ltpl::equal_by<2>, decltype(lhs), ltpl::Tuple<int, std::string>>));
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_FUNCTIONAL_HPP
@@ -0,0 +1,88 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_HASH_HPP
+#define LTPL_TEST_TEST_HASH_HPP
+
+#include <ltpl/hash.hpp>
+#include <ltpl/tuple.hpp>
+#include <test/framework.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+namespace test
+{
+struct NotHashable
+{
+};
+
+void test_hash()
+{
+    using Key = ltpl::Tuple<int, std::string, double>;
+    const std::hash<Key> hash{};
+    CHECK_EQ(hash(Key{1, "a", 2.}), hash(Key{1, "a", 2.}));
+    CHECK(hash(Key{1, "a", 2.}) != hash(Key{1, "b", 2.}));
+    CHECK(hash(Key{1, "a", 2.}) != hash(Key{2, "a", 2.}));
+    int i{1};
+    std::string s{"a"};
+    double d{2.};
+    using ReferenceKey = ltpl::Tuple<int&, const std::string&, double&>;
+    CHECK_EQ(hash(Key{1, "a", 2.}), std::hash<ReferenceKey>{}(ReferenceKey{i, s, d}));
+    CHECK(std::is_default_constructible_v<std::hash<ltpl::Tuple<>>>);
+    CHECK_FALSE(std::is_default_constructible_v<std::hash<ltpl::Tuple<int, NotHashable>>>);
+}
+
+void test_hash_bytewise()
+{
+    using Key = ltpl::Tuple<std::int32_t, std::int8_t, std::int64_t>;
+    const std::hash<Key> hash{};
+    CHECK(hash(Key{1, 2, 3}) != hash(Key{2, 1, 3}));
+    CHECK(hash(Key{1, 0, 0}) != hash(Key{0, 0, 1}));
+    std::int32_t a{1};
+    std::int8_t b{2};
+    std::int64_t c{3};
+    using ReferenceKey = ltpl::Tuple<std::int32_t&, std::int8_t&, std::int64_t&>;
+    CHECK_EQ(hash(Key{1, 2, 3}), std::hash<ReferenceKey>{}(ReferenceKey{a, b, c}));
+    std::unordered_set<std::size_t> hashes;
+    for (std::int32_t x{}; x != 100; ++x)
+    {
+        for (std::int64_t y{}; y != 100; ++y)
+        {
+            hashes.insert(hash(Key{x, 0, y}));
+        }
+    }
+    CHECK_EQ(10000, hashes.size());
+}
+
+void test_hash_batch()
+{
+    using Key = ltpl::Tuple<std::uint16_t, std::uint64_t>;
+    std::vector<Key> keys;
+    for (std::uint16_t i{}; i != 21; ++i)
+    {
+        keys.emplace_back(i, i * 3u);
+    }
+    std::vector<std::size_t> hashes(keys.size());
+    ltpl::hash_batch(std::span<const Key>{keys}, std::span{hashes});
+    for (std::size_t i{}; i != keys.size(); ++i)
+    {
+        CHECK_EQ(std::hash<Key>{}(keys[i]), hashes[i]);
+    }
+    using StringKey = ltpl::Tuple<std::string, int>;
+    const std::vector<StringKey> string_keys{{"a", 1}, {"b", 2}};
+    std::vector<std::size_t> string_hashes(string_keys.size());
+    ltpl::hash_batch(std::span<const StringKey>{string_keys}, std::span{string_hashes});
+    CHECK_EQ(std::hash<StringKey>{}(string_keys[1]), string_hashes[1]);
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_HASH_HPP
@@ -0,0 +1,70 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_HOMOGENEOUS_TUPLE_HPP
+#define LTPL_TEST_TEST_HOMOGENEOUS_TUPLE_HPP
+
+#include <ltpl/homogeneous_tuple.hpp>
+#include <ltpl/tuple.hpp>
+#include <test/framework.hpp>
+#include <test/utility.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace test
+{
+template <class Span>
+constexpr auto sum(Span span) noexcept
+{
+    typename Span::value_type result{};
+    for (auto v : span)
+    {
+        result += v;
+    }
+    return result;
+}
+
+void test_homogeneous_tuple()
+{
+    ltpl::HomogeneousTuple tuple{1.f, 2.f, 3.f, 4.f};
+    CHECK(std::is_same_v<ltpl::HomogeneousTuple<float, 4>, decltype(tuple)>);
+    CHECK_EQ(4 * sizeof(float), sizeof(tuple));
+    auto& [x, y, z, w] = tuple;
+    w = 5.f;
+    CHECK_EQ(5.f, ltpl::get<3>(tuple));
+    CHECK_EQ(11.f, sum(ltpl::as_span(tuple)));
+    CHECK_EQ(11.f, sum(ltpl::as_span(std::as_const(tuple))));
+    CHECK(std::is_same_v<float&&, decltype(ltpl::get<0>(std::move(tuple)))>);
+    static constexpr ltpl::HomogeneousTuple<std::uint64_t, 3> counters{1u, 2u, 3u};
+    static_assert(sum(ltpl::as_span(counters)) == 6u);
+}
+
+void test_homogeneous_tuple_conversion()
+{
+    ltpl::Tuple<int, short, long> tuple{1, short{2}, 3L};
+    ltpl::HomogeneousTuple<long, 3> homogeneous{tuple};
+    CHECK_EQ(3L, ltpl::get<2>(homogeneous));
+    auto back = static_cast<ltpl::Tuple<long, long, long>>(homogeneous);
+    CHECK_EQ(tuple, back);
+    ltpl::HomogeneousTuple<long, 3> other{4L, 5L, 6L};
+    swap(homogeneous, other);
+    CHECK_EQ((ltpl::HomogeneousTuple<long, 3>{4L, 5L, 6L}), homogeneous);
+}
+
+template <class T>
+concept AsSpan = requires(T& t) { ltpl::as_span(t); };
+
+void test_tuple_as_span_disabled()
+{
+    CHECK(AsSpan<ltpl::HomogeneousTuple<int, 2>>);
+    CHECK(AsSpan<const ltpl::HomogeneousTuple<std::string, 2>>);
+    // The captures of a Tuple are distinct objects, pointer arithmetic across them is undefined.
+    CHECK_FALSE(AsSpan<ltpl::Tuple<int, int>>);
+    CHECK_FALSE(AsSpan<ltpl::Tuple<double, double, double>>);
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_HOMOGENEOUS_TUPLE_HPP
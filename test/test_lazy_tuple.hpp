@@ -0,0 +1,132 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_LAZY_TUPLE_HPP
+#define LTPL_TEST_TEST_LAZY_TUPLE_HPP
+
+#include <ltpl/lazy_tuple.hpp>
+#include <test/framework.hpp>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace test
+{
+void test_lazy_tuple()
+{
+    int first_calls{};
+    int second_calls{};
+    ltpl::LazyTuple tuple{[&]
+                          {
+                              ++first_calls;
+                              return 42;
+                          },
+                          [&]
+                          {
+                              ++second_calls;
+                              return std::string("lazy");
+                          }};
+    CHECK((std::is_same_v<int, std::tuple_element_t<0, decltype(tuple)>>));
+    CHECK((std::is_same_v<std::string, std::tuple_element_t<1, decltype(tuple)>>));
+    CHECK_EQ(2, std::tuple_size_v<decltype(tuple)>);
+    CHECK_FALSE(tuple.has_value<1>());
+    CHECK_EQ("lazy", ltpl::get<1>(tuple));
+    CHECK_EQ("lazy", ltpl::get<1>(std::as_const(tuple)));
+    CHECK(tuple.has_value<1>());
+    CHECK_FALSE(tuple.has_value<0>());
+    CHECK_EQ(0, first_calls);
+    CHECK_EQ(1, second_calls);
+    ltpl::get<1>(tuple) += "!";
+    CHECK_EQ("lazy!", ltpl::get<1>(tuple));
+    CHECK_EQ(1, second_calls);
+}
+
+void test_lazy_tuple_structured_binding()
+{
+    int calls{};
+    ltpl::LazyTuple tuple{[&]
+                          {
+                              ++calls;
+                              return 1;
+                          },
+                          [&]
+                          {
+                              ++calls;
+                              return 2.;
+                          }};
+    auto& [i, d] = tuple;
+    CHECK_EQ(1, i);
+    CHECK_EQ(2., d);
+    CHECK_EQ(2, calls);
+    CHECK_EQ(&i, &ltpl::get<0>(tuple));
+}
+
+void test_lazy_tuple_retries_after_exception()
+{
+    int calls{};
+    ltpl::LazyTuple tuple{[&]
+                          {
+                              ++calls;
+                              if (calls == 1)
+                              {
+                                  throw std::runtime_error("first call");
+                              }
+                              return std::make_unique<int>(calls);
+                          }};
+    bool thrown{};
+    try
+    {
+        (void)ltpl::get<0>(tuple);
+    }
+    catch (const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    CHECK(thrown);
+    CHECK_FALSE(tuple.has_value<0>());
+    CHECK_EQ(2, *ltpl::get<0>(tuple));
+    auto moved = ltpl::get<0>(std::move(tuple));
+    CHECK_EQ(2, *moved);
+}
+
+void test_synchronized_lazy_tuple()
+{
+    std::atomic_int calls{};
+    ltpl::SynchronizedLazyTuple tuple{[&]
+                                      {
+                                          ++calls;
+                                          return std::vector<int>(100, 1);
+                                      }};
+    std::vector<std::thread> threads;
+    std::atomic_int sum{};
+    for (int i{}; i != 4; ++i)
+    {
+        threads.emplace_back(
+            [&]
+            {
+                int local{};
+                for (int v : ltpl::get<0>(tuple))
+                {
+                    local += v;
+                }
+                sum += local;
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    CHECK_EQ(1, calls.load());
+    CHECK_EQ(400, sum.load());
+    CHECK(tuple.has_value<0>());
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_LAZY_TUPLE_HPP
@@ -0,0 +1,82 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_MAPPED_TUPLE_TABLE_HPP
+#define LTPL_TEST_TEST_MAPPED_TUPLE_TABLE_HPP
+
+#include <ltpl/mapped_tuple_table.hpp>
+#include <ltpl/tuple.hpp>
+#include <test/framework.hpp>
+#include <test/temporary_file.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <vector>
+
+namespace test
+{
+void test_mapped_tuple_table()
+{
+    using Row = ltpl::Tuple<std::int64_t, float, std::uint8_t>;
+    std::vector<Row> rows;
+    for (std::int64_t i{}; i != 10000; ++i)
+    {
+        rows.emplace_back(i * 3, static_cast<float>(i) / 8, static_cast<std::uint8_t>(i % 256));
+    }
+    const TemporaryFile file{"mapped_tuple_table"};
+    CHECK(ltpl::write_tuple_table(file.path, std::span<const Row>{rows}));
+    CHECK_EQ(8 + 3 * 8 + rows.size() * (8 + 4 + 1), std::filesystem::file_size(file.path));
+    using Table = ltpl::MappedTupleTable<std::int64_t, float, std::uint8_t>;
+    const auto table = Table::open(file.path, ltpl::TupleTableAccess::SEQUENTIAL);
+    CHECK(table.has_value());
+    CHECK_EQ(rows.size(), table->size());
+    CHECK_FALSE(table->empty());
+    CHECK(table->begin() != table->end());
+    std::size_t i{};
+    for (const auto row : *table)
+    {
+        CHECK(row == rows[i]);
+        ++i;
+    }
+    CHECK_EQ(rows.size(), i);
+    table->advise(ltpl::TupleTableAccess::RANDOM);
+    CHECK_EQ(7 * 3, ltpl::get<0>((*table)[7]));
+    CHECK_EQ(9999 % 256, ltpl::get<2>((*table)[9999]));
+}
+
+void test_mapped_tuple_table_validation()
+{
+    using Row = ltpl::Tuple<std::int32_t, double>;
+    const std::vector<Row> rows{{1, 2.}, {3, 4.}};
+    const TemporaryFile file{"mapped_tuple_table_validation"};
+    CHECK(ltpl::write_tuple_table(file.path, std::span<const Row>{rows}));
+    CHECK(ltpl::MappedTupleTable<std::int32_t, double>::open(file.path).has_value());
+    CHECK_FALSE(ltpl::MappedTupleTable<float, double>::open(file.path).has_value());
+    CHECK_FALSE(ltpl::MappedTupleTable<std::uint32_t, double>::open(file.path).has_value());
+    CHECK_FALSE(ltpl::MappedTupleTable<double, std::int32_t>::open(file.path).has_value());
+    CHECK_FALSE(ltpl::MappedTupleTable<std::int32_t>::open(file.path).has_value());
+    std::filesystem::resize_file(file.path, std::filesystem::file_size(file.path) - 1);
+    CHECK_FALSE(ltpl::MappedTupleTable<std::int32_t, double>::open(file.path).has_value());
+    std::ofstream{file.path, std::ios::binary} << "not a table";
+    CHECK_FALSE(ltpl::MappedTupleTable<std::int32_t, double>::open(file.path).has_value());
+    std::filesystem::remove(file.path);
+    CHECK_FALSE(ltpl::MappedTupleTable<std::int32_t, double>::open(file.path).has_value());
+}
+
+void test_mapped_tuple_table_empty()
+{
+    const TemporaryFile file{"mapped_tuple_table_empty"};
+    CHECK(ltpl::write_tuple_table(file.path, std::span<const ltpl::Tuple<int>>{}));
+    const auto table = ltpl::MappedTupleTable<int>::open(file.path);
+    CHECK(table.has_value());
+    CHECK(table->empty());
+    CHECK(table->begin() == table->end());
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_MAPPED_TUPLE_TABLE_HPP
@@ -0,0 +1,192 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_MEMOIZE_HPP
+#define LTPL_TEST_TEST_MEMOIZE_HPP
+
+#include <ltpl/memoize.hpp>
+#include <test/framework.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace test
+{
+struct CopyCounter
+{
+    int value{};
+    int* copies{};
+
+    CopyCounter(int value, int* copies) : value(value), copies(copies) {}
+
+    CopyCounter(const CopyCounter& other) : value(other.value), copies(other.copies) { ++*copies; }
+
+    CopyCounter& operator=(const CopyCounter& other)
+    {
+        value = other.value;
+        copies = other.copies;
+        ++*copies;
+        return *this;
+    }
+
+    friend bool operator==(const CopyCounter& lhs, const CopyCounter& rhs) { return lhs.value == rhs.value; }
+};
+}  // namespace test
+
+template <>
+struct std::hash<test::CopyCounter>
+{
+    std::size_t operator()(const test::CopyCounter& counter) const noexcept { return std::hash<int>{}(counter.value); }
+};
+
+namespace test
+{
+template <class F>
+concept Memoizable = requires(F f) { ltpl::memoize(f, 1); };
+
+void test_memoize()
+{
+    int calls{};
+    auto memoized = ltpl::memoize(
+        [&](int i, const std::string& s)
+        {
+            ++calls;
+            return s + std::to_string(i);
+        },
+        4);
+    CHECK((std::is_same_v<ltpl::Tuple<int, std::string>, decltype(memoized)::key_type>));
+    CHECK_EQ("a1", memoized(1, "a"));
+    CHECK_EQ("a1", memoized(1, "a"));
+    CHECK_EQ("b1", memoized(1, "b"));
+    CHECK_EQ(2, calls);
+    CHECK_EQ(2, memoized.size());
+    CHECK_EQ(4, memoized.capacity());
+}
+
+void test_memoize_copies_arguments_only_on_miss()
+{
+    int copies{};
+    int calls{};
+    auto memoized = ltpl::memoize(
+        [&](const CopyCounter& counter)
+        {
+            ++calls;
+            return counter.value * 2;
+        },
+        2);
+    const CopyCounter counter{21, &copies};
+    CHECK_EQ(42, memoized(counter));
+    const auto copies_on_miss = copies;
+    CHECK(copies_on_miss > 0);
+    CHECK_EQ(42, memoized(counter));
+    CHECK_EQ(42, memoized(counter));
+    CHECK_EQ(copies_on_miss, copies);
+    CHECK_EQ(1, calls);
+}
+
+void test_memoize_reference_parameters_and_results()
+{
+    const std::vector<std::string> names{"a", "b"};
+    auto memoized = ltpl::memoize(
+        [&](const std::size_t& i) -> const std::string&
+        {
+            return names[i];
+        },
+        2);
+    CHECK((std::is_same_v<std::string, decltype(memoized(0))>));
+    CHECK_EQ("b", memoized(1));
+    auto by_value = [](std::string s)
+    {
+        return s;
+    };
+    auto by_lvalue_reference = [](std::string& s)
+    {
+        return s;
+    };
+    auto by_rvalue_reference = [](std::string&& s)
+    {
+        return s;
+    };
+    CHECK(Memoizable<decltype(by_value)>);
+    CHECK_FALSE(Memoizable<decltype(by_lvalue_reference)>);
+    CHECK_FALSE(Memoizable<decltype(by_rvalue_reference)>);
+    CHECK_FALSE(Memoizable<decltype([](auto i)
+                                    {
+                                        return i;
+                                    })>);
+}
+
+void test_memoize_clock_eviction()
+{
+    int calls{};
+    auto memoized = ltpl::memoize<int>(
+        [&](auto i)
+        {
+            ++calls;
+            return i * i;
+        },
+        2);
+    CHECK_EQ(1, memoized(1));
+    CHECK_EQ(4, memoized(2));
+    CHECK_EQ(2, calls);
+    // Both entries are referenced, the hand clears both flags and evicts 1.
+    CHECK_EQ(1, memoized(1));
+    CHECK_EQ(9, memoized(3));
+    CHECK_EQ(3, calls);
+    CHECK_EQ(2, memoized.size());
+    // 2 has not been referenced since its flag was cleared and is evicted next.
+    CHECK_EQ(16, memoized(4));
+    CHECK_EQ(9, memoized(3));
+    CHECK_EQ(4, calls);
+    CHECK_EQ(4, memoized(2));
+    CHECK_EQ(5, calls);
+    for (int i{}; i != 1000; ++i)
+    {
+        CHECK_EQ(i * i, memoized(i));
+    }
+    CHECK_EQ(2, memoized.size());
+}
+
+void test_memoize_sharded()
+{
+    std::atomic_int calls{};
+    const auto memoized = ltpl::memoize_sharded(
+        [&](int i)
+        {
+            ++calls;
+            return i + 1;
+        },
+        64, 4);
+    std::vector<std::thread> threads;
+    std::atomic_int failures{};
+    for (int t{}; t != 4; ++t)
+    {
+        threads.emplace_back(
+            [&]
+            {
+                for (int i{}; i != 1000; ++i)
+                {
+                    if (memoized(i % 32) != i % 32 + 1)
+                    {
+                        ++failures;
+                    }
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    CHECK_EQ(0, failures.load());
+    CHECK(calls.load() >= 32);
+    CHECK(calls.load() <= 4 * 32);
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_MEMOIZE_HPP
@@ -0,0 +1,121 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_RADIX_SORT_HPP
+#define LTPL_TEST_TEST_RADIX_SORT_HPP
+
+#include <ltpl/radix_sort.hpp>
+#include <ltpl/tuple.hpp>
+#include <test/framework.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace test
+{
+enum class Priority : std::int8_t
+{
+    LOW = -1,
+    HIGH = 1
+};
+
+template <class T>
+concept KeyEncodable = requires(const T& t, std::vector<unsigned char>& buffer) { ltpl::encode_key(t, buffer); };
+
+template <class Key>
+bool encoded_less(const Key& lhs, const Key& rhs)
+{
+    std::vector<unsigned char> l;
+    std::vector<unsigned char> r;
+    ltpl::encode_key(lhs, l);
+    ltpl::encode_key(rhs, r);
+    return std::lexicographical_compare(l.begin(), l.end(), r.begin(), r.end());
+}
+
+template <class Key>
+void check_encoded_order(const std::vector<Key>& keys)
+{
+    for (const auto& lhs : keys)
+    {
+        for (const auto& rhs : keys)
+        {
+            CHECK_EQ(lhs < rhs, encoded_less(lhs, rhs));
+        }
+    }
+}
+
+void test_encode_key()
+{
+    using namespace std::string_literals;
+    check_encoded_order<ltpl::Tuple<int, std::uint16_t, bool>>(
+        {{std::numeric_limits<int>::min(), 0, false}, {-1, 1, true}, {0, 65535, false}, {1, 0, true}, {-1, 0, true}});
+    check_encoded_order<ltpl::Tuple<double, float>>({{-std::numeric_limits<double>::infinity(), 1.f},
+                                                     {-2.5, -0.f},
+                                                     {-0., 0.f},
+                                                     {0., -1.f},
+                                                     {1e-300, 0.f},
+                                                     {3.5, 2.f},
+                                                     {std::numeric_limits<double>::max(), -3.f}});
+    check_encoded_order<ltpl::Tuple<std::string, Priority>>(
+        {{"", Priority::HIGH}, {"a", Priority::LOW}, {"a"s + '\0', Priority::LOW}, {"a"s + '\1', Priority::HIGH},
+         {"ab", Priority::LOW}, {"b", Priority::HIGH}, {"\xff", Priority::LOW}});
+    using Inner = ltpl::Tuple<std::string, int>;
+    check_encoded_order<ltpl::Tuple<Inner, std::string>>(
+        {{Inner{"a", 2}, "b"}, {Inner{"a", 1}, "c"}, {Inner{"ab", 0}, ""}, {Inner{"", 3}, "a"}});
+    CHECK_FALSE(encoded_less(ltpl::Tuple{-0.}, ltpl::Tuple{0.}));
+    CHECK_FALSE(encoded_less(ltpl::Tuple{0.}, ltpl::Tuple{-0.}));
+    std::vector<unsigned char> buffer{42};
+    ltpl::encode_key(ltpl::Tuple<std::uint16_t, std::int8_t>{0x0102, -1}, buffer);
+    CHECK((buffer == std::vector<unsigned char>{42, 0x01, 0x02, 0x7F}));
+    CHECK(KeyEncodable<ltpl::Tuple<int, ltpl::Tuple<std::string_view>>>);
+    CHECK_FALSE(KeyEncodable<ltpl::Tuple<int, const char*>>);
+    CHECK_FALSE(KeyEncodable<ltpl::Tuple<long double>>);
+}
+
+void test_radix_sort()
+{
+    using Row = ltpl::Tuple<std::int64_t, std::string, double>;
+    std::vector<Row> rows;
+    std::uint32_t state{1};
+    for (int i{}; i != 2000; ++i)
+    {
+        state = state * 1664525 + 1013904223;
+        rows.push_back(Row{static_cast<std::int64_t>(state % 64) - 32, std::string(state % 5, 'a' + (state >> 8) % 3),
+                           static_cast<double>(static_cast<int>(state >> 16) % 9 - 4) / 2});
+    }
+    auto expected = rows;
+    std::stable_sort(expected.begin(), expected.end());
+    ltpl::radix_sort(std::span{rows});
+    CHECK(rows == expected);
+    std::vector<ltpl::Tuple<int>> small{{3}, {-1}, {2}};
+    ltpl::radix_sort(std::span{small});
+    CHECK((small == std::vector<ltpl::Tuple<int>>{{-1}, {2}, {3}}));
+    std::vector<ltpl::Tuple<>> empty(3);
+    ltpl::radix_sort(std::span{empty});
+    CHECK_EQ(3, empty.size());
+}
+
+void test_radix_sort_long_common_prefix()
+{
+    const std::string prefix(2000, 'p');
+    std::vector<ltpl::Tuple<std::string, int>> rows;
+    for (int i{}; i != 64; ++i)
+    {
+        rows.emplace_back(prefix + std::string(static_cast<std::size_t>(i % 3), 'a' + static_cast<char>(i % 5)), i);
+    }
+    rows.emplace_back(prefix, 64);
+    auto expected = rows;
+    std::stable_sort(expected.begin(), expected.end());
+    ltpl::radix_sort(std::span{rows});
+    CHECK(rows == expected);
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_RADIX_SORT_HPP
@@ -0,0 +1,152 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_RECORD_LOG_HPP
+#define LTPL_TEST_TEST_RECORD_LOG_HPP
+
+#include <ltpl/record_log.hpp>
+#include <ltpl/tuple.hpp>
+#include <test/framework.hpp>
+#include <test/temporary_file.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace test
+{
+void test_record_log()
+{
+    using Record = ltpl::Tuple<std::int64_t, std::string>;
+    const TemporaryFile file{"record_log"};
+    {
+        auto log = ltpl::RecordLog<std::int64_t, std::string>::open(file.path);
+        CHECK(log.has_value());
+        CHECK(log->append(Record{1, "one"}));
+        CHECK(log->append(Record{2, ""}));
+        CHECK(log->sync());
+        CHECK(log->sync());
+    }
+    {
+        auto log = ltpl::RecordLog<std::int64_t, std::string>::open(file.path);
+        CHECK(log.has_value());
+        CHECK(log->append(Record{3, std::string(1000, 'x')}));
+    }
+    const auto reader = ltpl::RecordLogReader<std::int64_t, std::string>::open(file.path);
+    CHECK(reader.has_value());
+    std::vector<Record> records;
+    for (const auto& record : *reader)
+    {
+        records.push_back(record);
+    }
+    CHECK((records == std::vector<Record>{{1, "one"}, {2, ""}, {3, std::string(1000, 'x')}}));
+    CHECK_EQ(std::filesystem::file_size(file.path), reader->valid_size());
+}
+
+void test_record_log_concurrent()
+{
+    constexpr std::uint32_t THREADS = 8;
+    constexpr std::uint32_t RECORDS = 2000;
+    using Record = ltpl::Tuple<std::uint32_t, std::uint32_t>;
+    const TemporaryFile file{"record_log_concurrent"};
+    {
+        auto log = ltpl::RecordLog<std::uint32_t, std::uint32_t>::open(file.path, {.buffer_size = 256});
+        CHECK(log.has_value());
+        std::vector<std::thread> threads;
+        std::array<bool, THREADS> succeeded{};
+        for (std::uint32_t t{}; t != THREADS; ++t)
+        {
+            threads.emplace_back(
+                [&, t]
+                {
+                    bool ok = true;
+                    for (std::uint32_t i{}; i != RECORDS; ++i)
+                    {
+                        ok = log->append(Record{t, i}) && ok;
+                        if (i % 500 == 0)
+                        {
+                            ok = log->sync() && ok;
+                        }
+                    }
+                    succeeded[t] = ok;
+                });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        CHECK_EQ(THREADS, std::count(succeeded.begin(), succeeded.end(), true));
+    }
+    const auto reader = ltpl::RecordLogReader<std::uint32_t, std::uint32_t>::open(file.path);
+    CHECK(reader.has_value());
+    std::array<std::uint32_t, THREADS> next{};
+    std::size_t count{};
+    bool in_order = true;
+    for (const auto& [thread, i] : *reader)
+    {
+        in_order = in_order && thread < THREADS && next[thread] == i;
+        ++next[thread % THREADS];
+        ++count;
+    }
+    CHECK(in_order);
+    CHECK_EQ(THREADS * RECORDS, count);
+}
+
+void test_record_log_recovery()
+{
+    using Record = ltpl::Tuple<std::int32_t, std::string>;
+    const TemporaryFile file{"record_log_recovery"};
+    {
+        auto log = ltpl::RecordLog<std::int32_t, std::string>::open(file.path, {.buffer_size = 64});
+        CHECK(log.has_value());
+        CHECK(log->append(Record{1, "a"}));
+        CHECK(log->append(Record{2, "b"}));
+        CHECK_FALSE(log->append(Record{3, std::string(64, 'c')}));
+    }
+    const auto valid_size = std::filesystem::file_size(file.path);
+    {
+        // A record torn by a crash.
+        std::ofstream stream{file.path, std::ios::binary | std::ios::app};
+        stream.write("\x10\0\0\0\x01\x02", 6);
+    }
+    const auto reader = ltpl::RecordLogReader<std::int32_t, std::string>::open(file.path);
+    CHECK(reader.has_value());
+    CHECK_EQ(valid_size, reader->valid_size());
+    CHECK_EQ(2, std::ranges::distance(reader->begin(), reader->end()));
+    {
+        auto log = ltpl::RecordLog<std::int32_t, std::string>::open(file.path);
+        CHECK(log.has_value());
+        CHECK_EQ(valid_size, std::filesystem::file_size(file.path));
+        CHECK(log->append(Record{4, "d"}));
+    }
+    const auto appended_reader = ltpl::RecordLogReader<std::int32_t, std::string>::open(file.path);
+    CHECK(appended_reader.has_value());
+    std::vector<Record> records;
+    for (const auto& record : *appended_reader)
+    {
+        records.push_back(record);
+    }
+    CHECK((records == std::vector<Record>{{1, "a"}, {2, "b"}, {4, "d"}}));
+    {
+        // Flip a bit in the payload of the second record.
+        std::fstream stream{file.path, std::ios::binary | std::ios::in | std::ios::out};
+        stream.seekp(static_cast<std::streamoff>(valid_size) - 1);
+        stream.put('c');
+    }
+    const auto corrupt_reader = ltpl::RecordLogReader<std::int32_t, std::string>::open(file.path);
+    CHECK(corrupt_reader.has_value());
+    CHECK_EQ(1, std::ranges::distance(corrupt_reader->begin(), corrupt_reader->end()));
+    CHECK_FALSE(ltpl::RecordLogReader<int>::open(file.path.string() + "-missing"));
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_RECORD_LOG_HPP
@@ -0,0 +1,65 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_SELECT_HPP
+#define LTPL_TEST_TEST_SELECT_HPP
+
+#include <ltpl/select.hpp>
+#include <ltpl/tuple.hpp>
+#include <test/framework.hpp>
+#include <test/utility.hpp>
+
+#include <string>
+
+namespace test
+{
+void test_select_by_index()
+{
+    ltpl::Tuple<int, std::string, double, std::string> tuple{1, "a", 2., "b"};
+    auto selected = ltpl::select<3, 0>(tuple);
+    CHECK(std::is_same_v<ltpl::Tuple<std::string&, int&>, decltype(selected)>);
+    CHECK_EQ(&ltpl::get<3>(tuple), &ltpl::get<0>(selected));
+    ltpl::get<1>(selected) = 42;
+    CHECK_EQ(42, ltpl::get<0>(tuple));
+    CHECK_EQ((ltpl::Tuple<std::string, double>{"a", 2.}), (ltpl::select<1, 2>(tuple)));
+    CHECK(std::is_same_v<ltpl::Tuple<const std::string&>, decltype(ltpl::select<1>(std::as_const(tuple)))>);
+    CHECK(std::is_same_v<ltpl::Tuple<>, decltype(ltpl::select<>(tuple))>);
+    static constexpr ltpl::Tuple<int, double> constant{1, 2.};
+    static constexpr auto constant_selected = ltpl::select<1>(constant);
+    CHECK_EQ(2., ltpl::get<0>(constant_selected));
+}
+
+void test_select_by_index_rvalue()
+{
+    ltpl::Tuple<MoveOnly, int> tuple{MoveOnly{1}, 2};
+    auto selected = ltpl::select<0>(std::move(tuple));
+    CHECK(std::is_same_v<ltpl::Tuple<MoveOnly&&>, decltype(selected)>);
+    MoveOnly move_only{ltpl::get<0>(std::move(selected))};
+    CHECK(ltpl::get<0>(tuple).is_moved_from);
+    MoveOnly element{3};
+    ltpl::Tuple<MoveOnly&, int> ref_tuple{element, 4};
+    CHECK(std::is_same_v<ltpl::Tuple<MoveOnly&>, decltype(ltpl::select<0>(std::as_const(ref_tuple)))>);
+}
+
+void test_select_by_type()
+{
+    ltpl::Tuple<int, std::string, double> tuple{1, "a", 2.};
+    auto selected = ltpl::select<double, int>(tuple);
+    CHECK(std::is_same_v<ltpl::Tuple<double&, int&>, decltype(selected)>);
+    CHECK_EQ((ltpl::Tuple<double, int>{2., 1}), selected);
+}
+
+void test_drop()
+{
+    ltpl::Tuple<int, std::string, double, char> tuple{1, "a", 2., 'c'};
+    auto dropped = ltpl::drop<2, 0>(tuple);
+    CHECK(std::is_same_v<ltpl::Tuple<std::string&, char&>, decltype(dropped)>);
+    CHECK_EQ(&ltpl::get<1>(tuple), &ltpl::get<0>(dropped));
+    CHECK(std::is_same_v<ltpl::Tuple<const int&, const std::string&, const double&, const char&>,
+                         decltype(ltpl::drop<>(std::as_const(tuple)))>);
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_SELECT_HPP
@@ -0,0 +1,196 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_SERIALIZE_HPP
+#define LTPL_TEST_TEST_SERIALIZE_HPP
+
+#include <ltpl/serialize.hpp>
+#include <ltpl/tuple.hpp>
+#include <test/framework.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace test
+{
+struct Labeled
+{
+    std::string label;
+    int value{};
+
+    friend bool operator==(const Labeled&, const Labeled&) = default;
+};
+
+struct Point
+{
+    std::int32_t x;
+    std::int32_t y;
+
+    friend bool operator==(const Point&, const Point&) = default;
+};
+
+struct Node
+{
+    int value;
+    Node* next;
+};
+
+struct CountingByteSink
+{
+    void write(const std::byte* data, std::size_t size)
+    {
+        ++writes;
+        bytes.insert(bytes.end(), data, data + size);
+    }
+
+    std::vector<std::byte> bytes;
+    int writes{};
+};
+
+struct CountingByteSource
+{
+    bool read(std::byte* data, std::size_t size)
+    {
+        ++reads;
+        return source.read(data, size);
+    }
+
+    ltpl::SpanByteSource source;
+    int reads{};
+};
+
+template <class T>
+concept Serializable = requires(const T& t, ltpl::VectorByteSink& sink) { ltpl::serialize(t, sink); };
+
+template <class T>
+concept Deserializable = requires(ltpl::SpanByteSource& source) { ltpl::deserialize<T>(source); };
+}  // namespace test
+
+template <>
+inline constexpr bool ltpl::enable_trivial_serialization<test::Point> = true;
+
+template <>
+struct ltpl::Serializer<test::Labeled>
+{
+    template <class Sink>
+    static void write(Sink& sink, const test::Labeled& labeled)
+    {
+        ltpl::serialize(ltpl::Tuple<const std::string&, int>{labeled.label, labeled.value}, sink);
+    }
+
+    template <class Source>
+    static bool read(Source& source, test::Labeled& labeled)
+    {
+        auto tuple = ltpl::deserialize<ltpl::Tuple<std::string, int>>(source);
+        if (!tuple)
+        {
+            return false;
+        }
+        labeled = {std::move(ltpl::get<0>(*tuple)), ltpl::get<1>(*tuple)};
+        return true;
+    }
+};
+
+namespace test
+{
+void test_serialize()
+{
+    using Nested = ltpl::Tuple<char, std::string>;
+    using Row = ltpl::Tuple<std::int32_t, double, std::string, std::vector<std::int16_t>, Nested,
+                            std::vector<std::string>, Labeled>;
+    const Row row{-7,
+                  2.5,
+                  "text",
+                  std::vector<std::int16_t>{1, -2, 3},
+                  Nested{'x', ""},
+                  std::vector<std::string>{"a", "bc"},
+                  Labeled{"label", 42}};
+    std::vector<std::byte> bytes;
+    ltpl::VectorByteSink sink{bytes};
+    ltpl::serialize(row, sink);
+    ltpl::SpanByteSource source{bytes};
+    const auto result = ltpl::deserialize<Row>(source);
+    CHECK(result.has_value());
+    CHECK(*result == row);
+    CHECK(source.remaining().empty());
+    for (std::size_t size{}; size != bytes.size(); ++size)
+    {
+        ltpl::SpanByteSource truncated{std::span{bytes}.first(size)};
+        CHECK_FALSE(ltpl::deserialize<Row>(truncated).has_value());
+    }
+    CHECK(Serializable<ltpl::Tuple<const std::string&, int&>>);
+    CHECK_FALSE(Serializable<ltpl::Tuple<int*>>);
+    CHECK_FALSE(Serializable<ltpl::Tuple<std::vector<bool>>>);
+    CHECK(Deserializable<ltpl::Tuple<std::string, int>>);
+    CHECK_FALSE(Deserializable<ltpl::Tuple<const std::string&, int>>);
+}
+
+void test_serialize_trivial_class_types()
+{
+    using Row = ltpl::Tuple<Point, std::array<std::int16_t, 3>, std::string_view>;
+    const std::string text{"text"};
+    const Row row{Point{1, -2}, std::array<std::int16_t, 3>{3, 4, 5}, text};
+    std::vector<std::byte> bytes;
+    ltpl::VectorByteSink sink{bytes};
+    ltpl::serialize(row, sink);
+    CHECK_EQ(8 + 6 + 8 + text.size(), bytes.size());
+    ltpl::SpanByteSource source{bytes};
+    const auto result = ltpl::deserialize<ltpl::Tuple<Point, std::array<std::int16_t, 3>, std::string>>(source);
+    CHECK(result.has_value());
+    CHECK(ltpl::get<0>(*result) == ltpl::get<0>(row));
+    CHECK(ltpl::get<1>(*result) == ltpl::get<1>(row));
+    CHECK_EQ(text, ltpl::get<2>(*result));
+    CHECK(Serializable<ltpl::Tuple<std::string_view>>);
+    CHECK_FALSE(Deserializable<ltpl::Tuple<std::string_view>>);
+    CHECK_FALSE(Serializable<ltpl::Tuple<std::span<const int>>>);
+    CHECK_FALSE(Serializable<ltpl::Tuple<Node>>);
+}
+
+void test_serialize_combines_trivial_elements()
+{
+    CountingByteSink sink;
+    using Row = ltpl::Tuple<std::int32_t, std::int8_t, double, std::string, std::int64_t, char>;
+    const Row row{1, 2, 3., "four", 5, '6'};
+    ltpl::serialize(row, sink);
+    CHECK_EQ(4, sink.writes);
+    CHECK_EQ(4 + 1 + 8 + 8 + 4 + 8 + 1, sink.bytes.size());
+    CountingByteSource source{ltpl::SpanByteSource{sink.bytes}};
+    const auto result = ltpl::deserialize<Row>(source);
+    CHECK(result == row);
+    CHECK_EQ(4, source.reads);
+}
+
+void test_serialize_batch()
+{
+    std::vector<ltpl::Tuple<std::int64_t, float>> rows;
+    for (std::int64_t i{}; i != 1000; ++i)
+    {
+        rows.emplace_back(i, static_cast<float>(i) / 2);
+    }
+    CountingByteSink sink;
+    ltpl::serialize_batch(std::span<const ltpl::Tuple<std::int64_t, float>>{rows}, sink);
+    CHECK_EQ(8 + 1000 * 12, sink.bytes.size());
+    CHECK(sink.writes < 10);
+    ltpl::SpanByteSource source{sink.bytes};
+    CHECK(ltpl::deserialize_batch<ltpl::Tuple<std::int64_t, float>>(source) == rows);
+    ltpl::SpanByteSource truncated{std::span{sink.bytes}.first(sink.bytes.size() - 1)};
+    CHECK_FALSE(ltpl::deserialize_batch<ltpl::Tuple<std::int64_t, float>>(truncated).has_value());
+
+    const std::vector<ltpl::Tuple<std::string>> strings{{"a"}, {""}, {"bc"}};
+    std::vector<std::byte> bytes;
+    ltpl::VectorByteSink vector_sink{bytes};
+    ltpl::serialize_batch(std::span{strings}, vector_sink);
+    ltpl::SpanByteSource strings_source{bytes};
+    CHECK(ltpl::deserialize_batch<ltpl::Tuple<std::string>>(strings_source) == strings);
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_SERIALIZE_HPP
@@ -0,0 +1,71 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_STATIC_TUPLE_HPP
+#define LTPL_TEST_TEST_STATIC_TUPLE_HPP
+
+#include <ltpl/static_tuple.hpp>
+#include <ltpl/tuple.hpp>
+#include <test/framework.hpp>
+
+#include <type_traits>
+
+namespace test
+{
+#if __cpp_nontype_template_args >= 201911L
+template <ltpl::StaticTuple Config>
+constexpr int scale_and_offset(int v)
+{
+    if constexpr (ltpl::get<2>(Config))
+    {
+        return v * ltpl::get<0>(Config) + ltpl::get<1>(Config);
+    }
+    else
+    {
+        return v * ltpl::get<0>(Config);
+    }
+}
+#endif
+
+void test_static_tuple()
+{
+    constexpr ltpl::StaticTuple tuple{1, 'a', true};
+    CHECK((std::is_same_v<const ltpl::StaticTuple<int, char, bool>, decltype(tuple)>));
+    CHECK_EQ(3, std::tuple_size_v<std::remove_const_t<decltype(tuple)>>);
+    static_assert(ltpl::get<1>(tuple) == 'a');
+    static_assert(tuple == ltpl::StaticTuple{1, 'a', true});
+    static_assert(tuple != ltpl::StaticTuple{1, 'b', true});
+    const auto& [i, c, b] = tuple;
+    CHECK_EQ(1, i);
+    CHECK_EQ('a', c);
+    CHECK(b);
+    ltpl::StaticTuple<int, char> mutable_tuple{};
+    ltpl::get<0>(mutable_tuple) = 2;
+    CHECK_EQ(2, ltpl::get<0>(mutable_tuple));
+    CHECK_EQ(0, ltpl::get<1>(std::move(mutable_tuple)));
+}
+
+void test_static_tuple_conversion()
+{
+    constexpr ltpl::Tuple<int, char> tuple{1, 'a'};
+    constexpr ltpl::StaticTuple static_tuple{tuple};
+    CHECK((std::is_same_v<const ltpl::StaticTuple<int, char>, decltype(static_tuple)>));
+    static_assert(ltpl::get<0>(static_tuple) == 1);
+    static_assert(static_cast<ltpl::Tuple<int, char>>(static_tuple) == tuple);
+}
+
+void test_static_tuple_as_template_parameter()
+{
+#if __cpp_nontype_template_args >= 201911L
+    static_assert(scale_and_offset<ltpl::StaticTuple{2, 1, true}>(3) == 7);
+    static_assert(scale_and_offset<ltpl::StaticTuple{2, 1, false}>(3) == 6);
+    CHECK((&scale_and_offset<ltpl::StaticTuple{2, 1, true}> != &scale_and_offset<ltpl::StaticTuple{2, 1, false}>));
+    constexpr ltpl::Tuple<int, int, bool> config{3, 0, false};
+    static_assert(scale_and_offset<ltpl::StaticTuple{config}>(3) == 9);
+#endif
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_STATIC_TUPLE_HPP
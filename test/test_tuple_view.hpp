@@ -0,0 +1,110 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_TUPLE_VIEW_HPP
+#define LTPL_TEST_TEST_TUPLE_VIEW_HPP
+
+#include <ltpl/serialize.hpp>
+#include <ltpl/tuple.hpp>
+#include <ltpl/tuple_view.hpp>
+#include <test/framework.hpp>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace test
+{
+enum class Level : std::uint16_t
+{
+    INFO = 1,
+    ERROR = 0x0102
+};
+
+void test_tuple_view()
+{
+    using View = ltpl::TupleView<std::uint8_t, std::int64_t, double, Level, bool>;
+    static_assert(View::size_bytes == 1 + 8 + 8 + 2 + 1);
+    static_assert(View::offset<1> == 1);
+    static_assert(View::offset<4> == 19);
+    const ltpl::Tuple<std::uint8_t, std::int64_t, double, Level, bool> record{7, -42, 2.5, Level::ERROR, true};
+    std::array<std::byte, 1 + View::size_bytes> bytes{};
+    View::write(record, std::span{bytes}.subspan(1));
+    const View view{std::span{bytes}.subspan(1)};
+    CHECK_EQ(7, ltpl::get<0>(view));
+    CHECK_EQ(-42, ltpl::get<1>(view));
+    CHECK_EQ(2.5, ltpl::get<2>(view));
+    CHECK(Level::ERROR == ltpl::get<3>(view));
+    CHECK(ltpl::get<4>(view));
+    CHECK((std::is_same_v<std::int64_t, decltype(ltpl::get<1>(view))>));
+    const auto [a, b, c, d, e] = view;
+    CHECK_EQ(7, a);
+    CHECK_EQ(-42, b);
+    CHECK_EQ(2.5, c);
+    CHECK(Level::ERROR == d);
+    CHECK(e);
+    CHECK(view == record);
+    CHECK(static_cast<ltpl::Tuple<std::uint8_t, std::int64_t, double, Level, bool>>(view) == record);
+}
+
+void test_tuple_view_comparison()
+{
+    using View = ltpl::TupleView<std::int32_t, float>;
+    std::array<std::byte, View::size_bytes> bytes{};
+    View::write(ltpl::Tuple<std::int32_t, float>{3, 1.5f}, bytes);
+    const View view{bytes};
+    CHECK(view == (ltpl::Tuple<long, double>{3, 1.5}));
+    CHECK(view != (ltpl::Tuple<int, float>{3, 2.f}));
+    CHECK(view < (ltpl::Tuple<int, float>{4, 0.f}));
+    CHECK(view > (ltpl::Tuple<int, float>{3, 1.f}));
+    CHECK((view <=> ltpl::Tuple<int, float>{3, 1.5f}) == 0);
+    CHECK((std::is_same_v<std::partial_ordering, decltype(view <=> ltpl::Tuple<int, float>{})>));
+    CHECK_FALSE((std::is_invocable_v<std::equal_to<>, View, ltpl::Tuple<int>>));
+}
+
+void test_tuple_view_byte_order()
+{
+    using BigEndian = ltpl::BasicTupleView<std::endian::big, std::uint32_t, std::int16_t>;
+    const std::array<std::byte, 6> bytes{std::byte{0x01}, std::byte{0x02}, std::byte{0x03},
+                                         std::byte{0x04}, std::byte{0xFF}, std::byte{0xFE}};
+    const BigEndian view{bytes};
+    CHECK_EQ(0x01020304, ltpl::get<0>(view));
+    CHECK_EQ(-2, ltpl::get<1>(view));
+    std::array<std::byte, 6> written{};
+    BigEndian::write(ltpl::Tuple<std::uint32_t, std::int16_t>{0x01020304, -2}, written);
+    CHECK(written == bytes);
+}
+
+void test_tuple_view_over_serialized_records()
+{
+    using Record = ltpl::Tuple<std::int64_t, std::int32_t, double>;
+    std::vector<Record> records;
+    for (std::int32_t i{}; i != 100; ++i)
+    {
+        records.emplace_back(i * 1000, i, i / 4.);
+    }
+    std::vector<std::byte> bytes;
+    ltpl::VectorByteSink sink{bytes};
+    ltpl::serialize_batch(std::span<const Record>{records}, sink);
+    using View = ltpl::TupleView<std::int64_t, std::int32_t, double>;
+    const auto payload = std::span{bytes}.subspan(sizeof(std::uint64_t));
+    CHECK_EQ(records.size() * View::size_bytes, payload.size());
+    std::int64_t sum{};
+    for (std::size_t i{}; i != records.size(); ++i)
+    {
+        const View view{payload.subspan(i * View::size_bytes)};
+        sum += ltpl::get<1>(view);
+        CHECK(view == records[i]);
+    }
+    CHECK_EQ(99 * 100 / 2, sum);
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_TUPLE_VIEW_HPP
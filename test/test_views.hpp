@@ -0,0 +1,151 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_VIEWS_HPP
+#define LTPL_TEST_TEST_VIEWS_HPP
+
+#include <ltpl/tuple.hpp>
+#include <ltpl/views.hpp>
+#include <test/framework.hpp>
+#include <test/utility.hpp>
+
+#include <array>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace test
+{
+void test_zip_contiguous()
+{
+    std::vector<int> ints{1, 2, 3, 4};
+    const std::array<std::string, 3> strings{"a", "b", "c"};
+    auto zip = ltpl::views::zip(ints, strings);
+    CHECK_EQ(3u, zip.size());
+    auto it = zip.begin();
+    CHECK(std::is_same_v<std::random_access_iterator_tag, std::iterator_traits<decltype(it)>::iterator_category>);
+    CHECK(std::is_same_v<ltpl::Tuple<int&, const std::string&>, decltype(*it)>);
+    CHECK(std::is_same_v<ltpl::Tuple<int, std::string>, std::iterator_traits<decltype(it)>::value_type>);
+    CHECK_EQ(3, zip.end() - it);
+    CHECK_EQ((ltpl::Tuple<int, std::string>{3, "c"}), it[2]);
+    CHECK_EQ((ltpl::Tuple<int, std::string>{2, "b"}), *(it + 1));
+    CHECK(it < zip.end());
+    int count{};
+    for (auto [i, s] : zip)
+    {
+        i *= 10;
+        count += static_cast<int>(s.size());
+    }
+    CHECK_EQ(3, count);
+    CHECK_EQ((std::vector<int>{10, 20, 30, 4}), ints);
+}
+
+void test_zip_non_contiguous()
+{
+    std::list<int> ints{1, 2, 3};
+    std::vector<double> doubles{1., 2.};
+    auto zip = ltpl::views::zip(ints, doubles);
+    CHECK_EQ(2u, zip.size());
+    CHECK(std::is_same_v<std::forward_iterator_tag, std::iterator_traits<decltype(zip.begin())>::iterator_category>);
+    double sum{};
+    for (auto&& [i, d] : zip)
+    {
+        d += i;
+        sum += d;
+    }
+    CHECK_EQ(6., sum);
+    CHECK_EQ(4., doubles.back());
+}
+
+void test_zip_proxy_reference()
+{
+    std::vector<bool> bools{true, false, true};
+    const std::vector<int> ints{1, 2, 3};
+    auto zip = ltpl::views::zip(bools, ints);
+    CHECK(std::is_same_v<ltpl::Tuple<std::vector<bool>::reference, const int&>, decltype(*zip.begin())>);
+    int sum{};
+    for (auto [b, i] : zip)
+    {
+        sum += b ? i : 0;
+        b = i == 2;
+    }
+    CHECK_EQ(4, sum);
+    CHECK_EQ((std::vector<bool>{false, true, false}), bools);
+}
+
+void test_zip_index_loop()
+{
+    std::vector<float> a(64, 1.f);
+    std::vector<float> b(64, 2.f);
+    std::vector<float> c(64);
+    const auto zip = ltpl::views::zip(a, b, c);
+    for (auto it = zip.begin(), end = zip.end(); it != end; ++it)
+    {
+        auto [x, y, z] = *it;
+        z = x + y;
+    }
+    CHECK_EQ(std::vector<float>(64, 3.f), c);
+}
+
+void test_cartesian_product()
+{
+    std::vector<int> ints{1, 2};
+    const std::array<std::string, 3> strings{"a", "b", "c"};
+    auto product = ltpl::views::cartesian_product(ints, strings);
+    CHECK_EQ(6u, product.size());
+    CHECK(std::is_same_v<ltpl::Tuple<int&, const std::string&>, decltype(product[0])>);
+    std::vector<ltpl::Tuple<int, std::string>> expected;
+    for (auto i : ints)
+    {
+        for (const auto& s : strings)
+        {
+            expected.emplace_back(i, s);
+        }
+    }
+    std::vector<ltpl::Tuple<int, std::string>> actual;
+    for (auto&& element : product)
+    {
+        actual.emplace_back(element);
+    }
+    CHECK_EQ(expected, actual);
+    for (std::size_t i{}; i != product.size(); ++i)
+    {
+        CHECK_EQ(expected[i], product[i]);
+    }
+    CHECK_EQ(6, product.end() - product.begin());
+    CHECK_EQ(expected[4], *(product.begin() + 4));
+    CHECK_EQ(expected[2], product.begin()[2]);
+    auto it = product.end();
+    --it;
+    CHECK_EQ(expected[5], *it);
+    ltpl::get<0>(product[3]) = 42;
+    CHECK_EQ(42, ints[1]);
+}
+
+void test_cartesian_product_chunked()
+{
+    std::array<int, 3> a{1, 2, 3};
+    std::array<int, 4> b{10, 20, 30, 40};
+    std::array<int, 2> c{100, 200};
+    const auto product = ltpl::views::cartesian_product(a, b, c);
+    int sum{};
+    constexpr std::ptrdiff_t chunk_size = 5;
+    for (std::ptrdiff_t chunk{}; chunk < static_cast<std::ptrdiff_t>(product.size()); chunk += chunk_size)
+    {
+        const auto end = std::min(product.begin() + chunk + chunk_size, product.end());
+        for (auto it = product.begin() + chunk; it != end; ++it)
+        {
+            auto [x, y, z] = *it;
+            sum += x + y + z;
+        }
+    }
+    CHECK_EQ((1 + 2 + 3) * 8 + (10 + 20 + 30 + 40) * 6 + (100 + 200) * 12, sum);
+    std::vector<int> empty;
+    CHECK_EQ(0u, ltpl::views::cartesian_product(a, empty).size());
+    CHECK(ltpl::views::cartesian_product(a, empty).begin() == ltpl::views::cartesian_product(a, empty).end());
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_VIEWS_HPP
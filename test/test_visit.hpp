@@ -0,0 +1,80 @@
+// Copyright (c) 2022 Dennis Hezel
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LTPL_TEST_TEST_VISIT_HPP
+#define LTPL_TEST_TEST_VISIT_HPP
+
+#include <ltpl/tuple.hpp>
+#include <ltpl/visit.hpp>
+#include <test/framework.hpp>
+#include <test/utility.hpp>
+
+#include <string>
+#include <variant>
+
+namespace test
+{
+void test_visit_at_common_type()
+{
+    ltpl::Tuple<int, long, short> tuple{1, 2L, short{3}};
+    for (std::size_t i{}; i != 3; ++i)
+    {
+        const auto result = ltpl::visit_at(tuple, i,
+                                           [](auto v)
+                                           {
+                                               return v;
+                                           });
+        CHECK(std::is_same_v<const long, decltype(result)>);
+        CHECK_EQ(static_cast<long>(i + 1), result);
+    }
+    static constexpr ltpl::Tuple<int, double> constant{1, 2.};
+    static constexpr auto doubled = ltpl::visit_at(constant, 1,
+                                                   [](auto v)
+                                                   {
+                                                       return v * 2;
+                                                   });
+    CHECK_EQ(4., doubled);
+}
+
+void test_visit_at_reference()
+{
+    ltpl::Tuple<int, int, int> tuple{1, 2, 3};
+    auto& element = ltpl::visit_at(tuple, 1,
+                                   [](int& v) -> int&
+                                   {
+                                       return v;
+                                   });
+    element = 42;
+    CHECK_EQ(42, ltpl::get<1>(tuple));
+    MoveOnly move_only{1};
+    ltpl::Tuple<MoveOnly&&> rref_tuple{std::move(move_only)};
+    ltpl::visit_at(std::move(rref_tuple), 0,
+                   [](MoveOnly&& v)
+                   {
+                       MoveOnly other{std::move(v)};
+                   });
+    CHECK(move_only.is_moved_from);
+}
+
+void test_visit_at_variant()
+{
+    const ltpl::Tuple<int, std::string, int, Empty> tuple{1, "two", 3, Empty{}};
+    auto visitor = []<class T>(const T& v)
+    {
+        if constexpr (!std::is_same_v<Empty, T>)
+        {
+            return v;
+        }
+    };
+    using Variant = decltype(ltpl::visit_at(tuple, 0, visitor));
+    CHECK(std::is_same_v<std::variant<int, std::string, std::monostate>, Variant>);
+    CHECK_EQ(Variant{1}, ltpl::visit_at(tuple, 0, visitor));
+    CHECK_EQ(Variant{std::string{"two"}}, ltpl::visit_at(tuple, 1, visitor));
+    CHECK_EQ(Variant{3}, ltpl::visit_at(tuple, 2, visitor));
+    CHECK_EQ(Variant{std::monostate{}}, ltpl::visit_at(tuple, 3, visitor));
+}
+}  // namespace test
+
+#endif  // LTPL_TEST_TEST_VISIT_HPP